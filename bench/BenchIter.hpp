@@ -0,0 +1,46 @@
+/**
+ * @file BenchIter.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief An Iterator to call all the benchmark with clear information
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "DS/BTreeBench.hpp"
+#include "DS/BinaryTreeBench.hpp"
+#include "DS/ConcurrentSkipListBench.hpp"
+#include "DS/GraphBench.hpp"
+#include "DS/HuffmanCodecBench.hpp"
+#include "DS/HuffmanTreeBench.hpp"
+#include "DS/ImplicitBinaryTreeBench.hpp"
+#include "DS/SparseMatrixBench.hpp"
+#include "DS/SymbolHistogramBench.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace Bench {
+
+void run_all_bench() {
+    std::vector<std::function<void()>> bench_list = {
+        [] { BTreeBench(); },
+        [] { BinaryTreeBench(); },
+        [] { ConcurrentSkipListBench(); },
+        [] { HuffmanTreeBench(); },
+        [] { HuffmanCodecBench(); },
+        [] { SymbolHistogramBench(); },
+        [] { ImplicitBinaryTreeBench(); },
+        [] { SparseMatrixBench(); },
+        [] { GraphBench(); },
+    };
+    for (auto&& func : bench_list) {
+        func();
+    }
+}
+
+} // namespace Bench
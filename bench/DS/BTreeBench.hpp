@@ -0,0 +1,102 @@
+/**
+ * @file BTreeBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief BTree vs BST, insert / lookup / range scan
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BST.hpp"
+#include "../../src/DS/BTree.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Bench {
+
+void BTreeBench(int num_of_key = 10'000'000) {
+    Tool::bench_title_info("BTree_vs_BST");
+
+    std::vector<int> keys(num_of_key);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(33773));
+
+    std::vector<int> queries = keys;
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(7));
+
+    long long checksum = 0;
+    double    ms       = 0;
+
+    // BST (random insertion order, otherwise it degenerates)
+    {
+        DS::BST<int> bst;
+        ms = Tool::time_it([&] {
+            for (int key : keys) {
+                bst.insert(key);
+            }
+        });
+        Tool::bench_case_info("BST insert (random)", ms);
+        ms = Tool::time_it([&] {
+            for (int key : queries) {
+                checksum += bst.contains(key);
+            }
+        });
+        Tool::bench_case_info("BST lookup (random)", ms);
+    }
+    // BTree
+    {
+        DS::BTree<int, int> tree;
+        ms = Tool::time_it([&] {
+            for (int key : keys) {
+                tree.insert(key, key);
+            }
+        });
+        Tool::bench_case_info("BTree insert (random)", ms);
+        ms = Tool::time_it([&] {
+            for (int key : queries) {
+                checksum += tree.contains(key);
+            }
+        });
+        Tool::bench_case_info("BTree lookup (random)", ms);
+        ms = Tool::time_it([&] {
+            tree.range_scan(0, num_of_key, [&](int, int value) {
+                checksum += value;
+            });
+        });
+        Tool::bench_case_info("BTree range scan (all keys)", ms);
+    }
+    // BTree bulk load
+    {
+        std::vector<std::pair<int, int>> sorted(num_of_key);
+        for (int idx = 0; idx < num_of_key; ++idx) {
+            sorted[idx] = std::make_pair(idx, idx);
+        }
+        DS::BTree<int, int> tree;
+        ms = Tool::time_it([&] {
+            tree = DS::BTree<int, int>::from_sorted(sorted);
+        });
+        Tool::bench_case_info("BTree bulk load (sorted)", ms);
+        ms = Tool::time_it([&] {
+            for (int key : queries) {
+                checksum += tree.contains(key);
+            }
+        });
+        Tool::bench_case_info("BTree lookup after bulk load", ms);
+    }
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("BTree_vs_BST");
+}
+
+} // namespace Bench
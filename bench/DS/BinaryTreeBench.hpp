@@ -0,0 +1,119 @@
+/**
+ * @file BinaryTreeBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief BinaryTree traversal, std::function vs template visitor vs Morris
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BinaryTree.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Bench {
+
+/// @brief wire format of a complete tree (heap indexes, value = index)
+std::vector<std::uint8_t> complete_tree_buffer(int num_of_node) {
+    std::vector<std::uint8_t> buffer;
+    auto                      write_varint = [&](std::uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<std::uint8_t>(value));
+    };
+    write_varint(num_of_node);
+    std::size_t bitmap_pos = buffer.size();
+    buffer.resize(buffer.size() + (2 * static_cast<std::size_t>(num_of_node) + 7) / 8, 0);
+
+    std::vector<std::uint8_t> values;
+    std::vector<long long>    stack { 0 };
+    std::size_t               bit = 0;
+    while (num_of_node && !stack.empty()) {
+        long long idx = stack.back();
+        stack.pop_back();
+        for (long long child : { 2 * idx + 1, 2 * idx + 2 }) {
+            if (child < num_of_node) {
+                buffer[bitmap_pos + bit / 8] |= static_cast<std::uint8_t>(1u << (bit % 8));
+            }
+            ++bit;
+        }
+        // zigzag of a non-negative int
+        std::uint64_t value = static_cast<std::uint64_t>(idx) << 1;
+        while (value >= 0x80) {
+            values.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        values.push_back(static_cast<std::uint8_t>(value));
+        if (2 * idx + 2 < num_of_node) {
+            stack.push_back(2 * idx + 2);
+        }
+        if (2 * idx + 1 < num_of_node) {
+            stack.push_back(2 * idx + 1);
+        }
+    }
+    buffer.insert(buffer.end(), values.begin(), values.end());
+    return buffer;
+}
+
+void BinaryTreeBench(int num_of_node = 10'000'000) {
+    Tool::bench_title_info("BinaryTree_Traverse");
+
+    DS::BinaryTree<int> tree
+        = DS::BinaryTree<int>::DeserializeFromBuffer(complete_tree_buffer(num_of_node));
+    using NodePtr = decltype(tree.Root());
+
+    long long checksum = 0;
+    double    ms       = 0;
+
+    // the old way => one indirect call per node
+    std::function<void(NodePtr)> type_erased = [&](NodePtr node) {
+        checksum += tree.Value(node);
+    };
+    auto visitor = [&](NodePtr node) {
+        checksum += tree.Value(node);
+    };
+
+    ms = Tool::time_it([&] { tree.PreOrderOpt(type_erased); });
+    Tool::bench_case_info("pre-order (std::function)", ms);
+    ms = Tool::time_it([&] { tree.PreOrderOpt(visitor); });
+    Tool::bench_case_info("pre-order (template)", ms);
+    ms = Tool::time_it([&] { tree.PreOrderOpt_Rec(visitor); });
+    Tool::bench_case_info("pre-order (template, recursive)", ms);
+    ms = Tool::time_it([&] { tree.MorrisPreOrderOpt(visitor); });
+    Tool::bench_case_info("pre-order (Morris)", ms);
+
+    ms = Tool::time_it([&] { tree.InOrderOpt(type_erased); });
+    Tool::bench_case_info("in-order (std::function)", ms);
+    ms = Tool::time_it([&] { tree.InOrderOpt(visitor); });
+    Tool::bench_case_info("in-order (template)", ms);
+    ms = Tool::time_it([&] { tree.InOrderOpt_Rec(visitor); });
+    Tool::bench_case_info("in-order (template, recursive)", ms);
+    ms = Tool::time_it([&] { tree.MorrisInOrderOpt(visitor); });
+    Tool::bench_case_info("in-order (Morris)", ms);
+
+    ms = Tool::time_it([&] { tree.PostOrderOpt(type_erased); });
+    Tool::bench_case_info("post-order (std::function)", ms);
+    ms = Tool::time_it([&] { tree.PostOrderOpt(visitor); });
+    Tool::bench_case_info("post-order (template)", ms);
+
+    ms = Tool::time_it([&] { tree.LevelOrderOpt(type_erased); });
+    Tool::bench_case_info("level-order (std::function)", ms);
+    ms = Tool::time_it([&] { tree.LevelOrderOpt(visitor); });
+    Tool::bench_case_info("level-order (template)", ms);
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("BinaryTree_Traverse");
+}
+
+} // namespace Bench
@@ -0,0 +1,99 @@
+/**
+ * @file ConcurrentSkipListBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief ConcurrentSkipList vs (BST + global mutex), 1 ~ 32 threads
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BST.hpp"
+#include "../../src/DS/ConcurrentSkipList.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Bench {
+
+/// @brief read-mostly mix => 90% contains, 5% insert, 5% remove
+template <typename Set>
+double run_read_mostly_mix(Set& set, int num_of_thread, int ops_per_thread, int key_range) {
+    return Tool::time_it([&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < num_of_thread; ++t) {
+            workers.emplace_back([&set, t, ops_per_thread, key_range] {
+                std::mt19937 gen(t + 1);
+                for (int op = 0; op < ops_per_thread; ++op) {
+                    int key    = static_cast<int>(gen() % key_range);
+                    int choice = static_cast<int>(gen() % 100);
+                    if (choice < 90) {
+                        set.contains(key);
+                    } else if (choice < 95) {
+                        set.insert(key);
+                    } else {
+                        set.remove(key);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+void ConcurrentSkipListBench(int key_range = 1'000'000, int ops_per_thread = 200'000) {
+    Tool::bench_title_info("ConcurrentSkipList_Scaling");
+
+    struct LockedBST {
+        DS::BST<int> tree;
+        std::mutex   lock;
+
+        bool contains(int key) {
+            std::lock_guard<std::mutex> guard(lock);
+            return tree.contains(key);
+        }
+        void insert(int key) {
+            std::lock_guard<std::mutex> guard(lock);
+            tree.insert(key);
+        }
+        void remove(int key) {
+            std::lock_guard<std::mutex> guard(lock);
+            tree.remove(key);
+        }
+    };
+
+    std::vector<int> prefill;
+    for (int key = 0; key < key_range; key += 2) {
+        prefill.push_back(key);
+    }
+
+    for (int num_of_thread : { 1, 2, 4, 8, 16, 32 }) {
+        std::string suffix = " (" + std::to_string(num_of_thread) + " threads)";
+
+        LockedBST locked;
+        locked.tree = DS::BST<int>::from_sorted(prefill);
+        double ms   = run_read_mostly_mix(locked, num_of_thread, ops_per_thread, key_range);
+        Tool::bench_case_info(("BST + mutex" + suffix).c_str(), ms);
+
+        DS::ConcurrentSkipList<int> list;
+        for (int key : prefill) {
+            list.insert(key);
+        }
+        ms = run_read_mostly_mix(list, num_of_thread, ops_per_thread, key_range);
+        Tool::bench_case_info(("ConcurrentSkipList" + suffix).c_str(), ms);
+    }
+    std::cout << std::endl;
+
+    Tool::bench_end_info("ConcurrentSkipList_Scaling");
+}
+
+} // namespace Bench
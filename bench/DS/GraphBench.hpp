@@ -0,0 +1,194 @@
+/**
+ * @file GraphBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Graph, streaming vertex / arc updates, vertex name lookups, dense
+ *        BFS / triangles on arc lists vs the bitset mode, snapshot vs rebuild
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/FlatHashMap.hpp"
+#include "../../src/DS/Graph.hpp"
+#include "../../src/DS/GraphSnapshot.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace Bench {
+
+void GraphBench(int num_of_vex = 200'000, int arc_per_vex = 8) {
+    Tool::bench_title_info("Graph");
+
+    std::mt19937 gen(33773);
+    double       ms       = 0;
+    long long    checksum = 0;
+
+    std::vector<int> vexes(num_of_vex);
+    std::iota(vexes.begin(), vexes.end(), 0);
+    DS::Graph<int>::WEdgeList arcs;
+    arcs.reserve(static_cast<std::size_t>(num_of_vex) * arc_per_vex);
+    for (int from = 0; from < num_of_vex; ++from) {
+        for (int idx = 0; idx < arc_per_vex; ++idx) {
+            arcs.emplace_back(from, static_cast<int>(gen() % num_of_vex), static_cast<int>(gen() % 100 + 1));
+        }
+    }
+
+    for (bool if_directed : { false, true }) {
+        const std::string suffix = (if_directed) ? ", directed" : ", undirected";
+
+        DS::Graph<int> graph(std::vector<int> {}, DS::Graph<int>::WEdgeList {}, if_directed);
+        ms = Tool::time_it([&] {
+            for (int vex : vexes) {
+                graph.InsertVex(vex);
+            }
+        });
+        Tool::bench_case_info(("insert vertexes" + suffix).c_str(), ms);
+        ms = Tool::time_it([&] {
+            for (auto&& [from, to, weight] : arcs) {
+                graph.InsertArc(from, to, weight);
+            }
+        });
+        Tool::bench_case_info(("insert arcs" + suffix).c_str(), ms);
+
+        // churn => delete a random tenth of the arcs and of the vertexes
+        ms = Tool::time_it([&] {
+            for (std::size_t idx = 0; idx < arcs.size(); idx += 10) {
+                graph.DeleteArc(std::get<0>(arcs[idx]), std::get<1>(arcs[idx]));
+            }
+        });
+        Tool::bench_case_info(("delete arcs" + suffix).c_str(), ms);
+        ms = Tool::time_it([&] {
+            for (int vex = 0; vex < num_of_vex; vex += 10) {
+                graph.DeleteVex(vex);
+            }
+        });
+        Tool::bench_case_info(("delete vertexes" + suffix).c_str(), ms);
+        checksum += graph.GetVexNum();
+    }
+
+    // name => index, node based vs flat (random hits, then misses)
+    {
+        std::vector<std::string> names(num_of_vex);
+        for (int idx = 0; idx < num_of_vex; ++idx) {
+            names[idx] = "vertex_" + std::to_string(idx * 7919);
+        }
+        std::vector<std::string> queries = names;
+        std::shuffle(queries.begin(), queries.end(), gen);
+        for (int idx = 0; idx < num_of_vex; ++idx) {
+            queries.push_back("missing_" + std::to_string(idx));
+        }
+
+        std::unordered_map<std::string, int> node_map;
+        DS::FlatHashMap<std::string, int>    flat_map;
+        ms = Tool::time_it([&] {
+            for (int idx = 0; idx < num_of_vex; ++idx) {
+                node_map[names[idx]] = idx;
+            }
+        });
+        Tool::bench_case_info("name insert, unordered_map", ms);
+        ms = Tool::time_it([&] {
+            for (int idx = 0; idx < num_of_vex; ++idx) {
+                flat_map[names[idx]] = idx;
+            }
+        });
+        Tool::bench_case_info("name insert, FlatHashMap", ms);
+        ms = Tool::time_it([&] {
+            for (const std::string& name : queries) {
+                auto iter = node_map.find(name);
+                checksum += (iter != node_map.end()) ? iter->second : -1;
+            }
+        });
+        Tool::bench_case_info("name lookup, unordered_map", ms);
+        ms = Tool::time_it([&] {
+            for (const std::string& name : queries) {
+                const int* found = flat_map.find(name);
+                checksum += (found) ? *found : -1;
+            }
+        });
+        Tool::bench_case_info("name lookup, FlatHashMap", ms);
+    }
+
+    // dense unweighted => arc lists vs one bit per arc (BFS, triangles)
+    {
+        const int      num_of_dense = 4096;
+        DS::Graph<int> list_graph(std::vector<int>(vexes.begin(), vexes.begin() + num_of_dense), DS::Graph<int>::EdgeList {});
+        DS::Graph<int> bit_graph(std::vector<int>(vexes.begin(), vexes.begin() + num_of_dense), DS::Graph<int>::EdgeList {}, false, true);
+        long long      num_of_edge = 0;
+        for (int a_vex = 0; a_vex < num_of_dense; ++a_vex) {
+            for (int b_vex = a_vex + 1; b_vex < num_of_dense; ++b_vex) {
+                if (gen() % 16 == 0) {
+                    list_graph.InsertArc(a_vex, b_vex);
+                    bit_graph.InsertArc(a_vex, b_vex);
+                    ++num_of_edge;
+                }
+            }
+        }
+        const long long list_byte = num_of_edge * 2 * static_cast<long long>(sizeof(DS::Graph<int>::Arc));
+        const long long bit_byte  = static_cast<long long>(num_of_dense) * ((num_of_dense + 63) / 64) * 8;
+        const long long mat_byte  = static_cast<long long>(num_of_dense) * num_of_dense * static_cast<long long>(sizeof(int));
+        std::cout << "dense adjacency bytes, int matrix : " << mat_byte << std::endl;
+        std::cout << "dense adjacency bytes, lists      : " << list_byte << std::endl;
+        std::cout << "dense adjacency bytes, bitset     : " << bit_byte << std::endl;
+
+        for (auto* graph : { &list_graph, &bit_graph }) {
+            const std::string suffix = (graph->IfBitset()) ? ", bitset" : ", lists";
+
+            ms = Tool::time_it([&] {
+                for (int source = 0; source < num_of_dense; source += 256) {
+                    checksum += graph->GetHopDist(source).back();
+                }
+            });
+            Tool::bench_case_info(("dense BFS x16" + suffix).c_str(), ms);
+            ms = Tool::time_it([&] { checksum += graph->CountTriangles(); });
+            Tool::bench_case_info(("dense triangles" + suffix).c_str(), ms);
+        }
+    }
+
+    // start up => rebuild from the edge list vs map a snapshot
+    {
+        const std::string path = "graph_bench.snapshot";
+
+        std::optional<DS::Graph<int>> graph;
+        ms = Tool::time_it([&] { graph.emplace(vexes, arcs, true); });
+        Tool::bench_case_info("rebuild from edge list", ms);
+        ms = Tool::time_it([&] { DS::GraphSnapshot::save(path, *graph); });
+        Tool::bench_case_info("snapshot save", ms);
+        ms = Tool::time_it([&] {
+            DS::GraphSnapshot snapshot(path);
+            checksum += static_cast<long long>(snapshot.get_arc_num());
+        });
+        Tool::bench_case_info("snapshot open", ms);
+        DS::GraphSnapshot snapshot(path);
+        ms = Tool::time_it([&] {
+            for (std::size_t idx = 0; idx < snapshot.get_vex_num(); ++idx) {
+                for (std::int32_t weight : snapshot.weights(idx)) {
+                    checksum += weight;
+                }
+            }
+        });
+        Tool::bench_case_info("snapshot scan all arcs", ms);
+        std::remove(path.c_str());
+    }
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("Graph");
+}
+
+} // namespace Bench
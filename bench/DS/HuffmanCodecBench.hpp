@@ -0,0 +1,110 @@
+/**
+ * @file HuffmanCodecBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Huffman encode / decode throughput
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/AdaptiveHuffman.hpp"
+#include "../../src/DS/HuffmanCodec.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+/// @brief the given corpus file, or zipf distributed words when it is missing
+std::vector<std::uint8_t> load_corpus(const std::string& corpus_path, std::size_t synthetic_size) {
+    if (!corpus_path.empty()) {
+        std::ifstream in(corpus_path, std::ios::binary);
+        if (in) {
+            std::cout << "corpus : " << corpus_path << std::endl;
+            return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+        }
+    }
+    std::cout << "corpus : synthetic text" << std::endl;
+    std::mt19937             gen(33773);
+    std::vector<std::string> words;
+    for (int i = 0; i < 5000; ++i) {
+        std::string word;
+        int         length = 2 + static_cast<int>(gen() % 8);
+        for (int j = 0; j < length; ++j) {
+            word.push_back(static_cast<char>('a' + gen() % 26));
+        }
+        words.push_back(word);
+    }
+    std::vector<double> zipf(words.size());
+    for (std::size_t rank = 0; rank < zipf.size(); ++rank) {
+        zipf[rank] = 1.0 / static_cast<double>(rank + 1);
+    }
+    std::discrete_distribution<std::size_t> pick(zipf.begin(), zipf.end());
+
+    std::vector<std::uint8_t> res;
+    res.reserve(synthetic_size + 16);
+    while (res.size() < synthetic_size) {
+        const std::string& word = words[pick(gen)];
+        res.insert(res.end(), word.begin(), word.end());
+        res.push_back((gen() % 12 == 0) ? '\n' : ' ');
+    }
+    return res;
+}
+
+void HuffmanCodecBench(const std::string& corpus_path = "", std::size_t synthetic_size = 64 << 20) {
+    Tool::bench_title_info("Huffman_Codec");
+
+    std::vector<std::uint8_t> corpus = load_corpus(corpus_path, synthetic_size);
+    std::vector<std::uint8_t> compressed;
+    std::vector<std::uint8_t> restored;
+    double                    ms = 0;
+
+    ms = Tool::time_it([&] { compressed = DS::HuffmanCodec::compress(corpus); });
+    Tool::bench_throughput_info("compress (count + build + encode)", ms, corpus.size());
+    ms = Tool::time_it([&] { restored = DS::HuffmanCodec::decompress(compressed); });
+    Tool::bench_throughput_info("decompress (table driven)", ms, corpus.size());
+
+    for (unsigned num_of_thread : { 1u, 2u, 4u, 8u }) {
+        std::string suffix = " (" + std::to_string(num_of_thread) + " threads)";
+
+        ms = Tool::time_it([&] { compressed = DS::BlockHuffmanCodec::compress(corpus, 1 << 20, num_of_thread); });
+        Tool::bench_throughput_info(("block compress" + suffix).c_str(), ms, corpus.size());
+        ms = Tool::time_it([&] { restored = DS::BlockHuffmanCodec::decompress(compressed, num_of_thread); });
+        Tool::bench_throughput_info(("block decompress" + suffix).c_str(), ms, corpus.size());
+    }
+
+    // one pass, no table => no histogram either
+    {
+        std::vector<std::uint8_t> adaptive;
+        std::vector<std::uint8_t> adaptive_restored;
+        ms = Tool::time_it([&] {
+            DS::AdaptiveHuffmanEncoder encoder(adaptive);
+            encoder.encode(corpus);
+            encoder.finish();
+        });
+        Tool::bench_throughput_info("adaptive compress (FGK)", ms, corpus.size());
+        ms = Tool::time_it([&] { DS::AdaptiveHuffmanDecoder().decode(adaptive, adaptive_restored); });
+        Tool::bench_throughput_info("adaptive decompress (FGK)", ms, corpus.size());
+        std::cout << "adaptive ratio : " << static_cast<double>(adaptive.size()) / corpus.size()
+                  << (adaptive_restored == corpus ? " (round trip ok)" : " (round trip FAILED)")
+                  << std::endl;
+    }
+
+    std::cout << "ratio : " << static_cast<double>(compressed.size()) / corpus.size()
+              << (restored == corpus ? " (round trip ok)" : " (round trip FAILED)")
+              << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("Huffman_Codec");
+}
+
+} // namespace Bench
@@ -0,0 +1,61 @@
+/**
+ * @file HuffmanTreeBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief HuffmanTree construction, linear scan vs heap vs two queues
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/HuffmanTree.hpp"
+#include "../../tools/BenchTool.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+/// @brief zipf-like weights, as seen for tokenized text
+DS::HuffmanTree<int>::InitPairList zipf_weights(int num_of_symbol) {
+    DS::HuffmanTree<int>::InitPairList init;
+    std::mt19937                       gen(33773);
+    for (int symbol = 0; symbol < num_of_symbol; ++symbol) {
+        init.emplace_back(symbol, 1'000'000 / (symbol + 1) + static_cast<int>(gen() % 16));
+    }
+    return init;
+}
+
+void HuffmanTreeBench(int num_of_symbol = 65536) {
+    Tool::bench_title_info("HuffmanTree_Build");
+
+    using Strategy = DS::HuffmanTree<int>::BuildStrategy;
+
+    double ms = 0;
+    for (int num : { 4096, num_of_symbol }) {
+        auto init_heap      = zipf_weights(num);
+        auto init_two_queue = zipf_weights(num);
+        auto init_linear    = zipf_weights(num);
+
+        std::string suffix = " (" + std::to_string(num) + " symbols)";
+
+        ms = Tool::time_it([&] { DS::HuffmanTree<int> tree(init_heap, Strategy::Heap); });
+        Tool::bench_case_info(("heap" + suffix).c_str(), ms);
+        ms = Tool::time_it([&] { DS::HuffmanTree<int> tree(init_two_queue, Strategy::TwoQueue); });
+        Tool::bench_case_info(("two queue" + suffix).c_str(), ms);
+        // O(n^2) => only on the small alphabet
+        if (num <= 4096) {
+            ms = Tool::time_it([&] { DS::HuffmanTree<int> tree(init_linear, Strategy::LinearScan); });
+            Tool::bench_case_info(("linear scan" + suffix).c_str(), ms);
+        }
+    }
+    std::cout << std::endl;
+
+    Tool::bench_end_info("HuffmanTree_Build");
+}
+
+} // namespace Bench
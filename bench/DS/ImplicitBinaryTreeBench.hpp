@@ -0,0 +1,91 @@
+/**
+ * @file ImplicitBinaryTreeBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Eytzinger search vs std::lower_bound, implicit vs pointer traversal
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BinaryTree.hpp"
+#include "../../src/DS/ImplicitBinaryTree.hpp"
+#include "../../tools/BenchTool.hpp"
+#include "BinaryTreeBench.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace Bench {
+
+void ImplicitBinaryTreeBench(int num_of_node = 10'000'000, int num_of_query = 10'000'000) {
+    Tool::bench_title_info("ImplicitBinaryTree");
+
+    using Implicit = DS::ImplicitBinaryTree<int>;
+
+    long long checksum = 0;
+    double    ms       = 0;
+
+    // search
+    {
+        std::vector<int> sorted(num_of_node);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        for (int& value : sorted) {
+            value *= 2;
+        }
+        std::vector<int> queries(num_of_query);
+        std::mt19937     gen(33773);
+        for (int& query : queries) {
+            query = static_cast<int>(gen() % (2u * num_of_node - 1)); // always found
+        }
+        Implicit eytzinger = Implicit::FromSorted(sorted);
+
+        ms = Tool::time_it([&] {
+            for (int query : queries) {
+                checksum += *std::lower_bound(sorted.begin(), sorted.end(), query);
+            }
+        });
+        Tool::bench_case_info("std::lower_bound (sorted array)", ms);
+        ms = Tool::time_it([&] {
+            for (int query : queries) {
+                checksum += eytzinger.Value(eytzinger.LowerBound(query));
+            }
+        });
+        Tool::bench_case_info("LowerBound (eytzinger, prefetch)", ms);
+    }
+    // traversal
+    {
+        DS::BinaryTree<int> tree
+            = DS::BinaryTree<int>::DeserializeFromBuffer(complete_tree_buffer(num_of_node));
+        Implicit implicit = Implicit::FromBinaryTree(tree);
+
+        ms = Tool::time_it([&] {
+            tree.InOrderOpt([&](auto* node) { checksum += tree.Value(node); });
+        });
+        Tool::bench_case_info("in-order (pointer nodes)", ms);
+        ms = Tool::time_it([&] {
+            implicit.InOrderOpt([&](Implicit::Index idx) { checksum += implicit.Value(idx); });
+        });
+        Tool::bench_case_info("in-order (implicit)", ms);
+        ms = Tool::time_it([&] {
+            tree.LevelOrderOpt([&](auto* node) { checksum += tree.Value(node); });
+        });
+        Tool::bench_case_info("level-order (pointer nodes)", ms);
+        ms = Tool::time_it([&] {
+            implicit.LevelOrderOpt([&](Implicit::Index idx) { checksum += implicit.Value(idx); });
+        });
+        Tool::bench_case_info("level-order (implicit)", ms);
+    }
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("ImplicitBinaryTree");
+}
+
+} // namespace Bench
@@ -0,0 +1,244 @@
+/**
+ * @file SparseMatrixBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief SpMV (triples vs CSR vs CSC vs BSR), SpGEMM, sparse add, transposes, loading
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/SparseMatrix.hpp"
+#include "../../tools/BenchTool.hpp"
+#include "../../tools/Parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+/// @brief `num_of_row x num_of_col`, ~`nnz_per_row` random cols per row,
+/// every 64th row is 16 times heavier (power-law-ish rows)
+DS::CSRMatrix<double> random_sparse(std::size_t num_of_row, std::size_t num_of_col, std::size_t nnz_per_row) {
+    std::mt19937_64          gen(33773);
+    std::vector<std::size_t> row_ptr = { 0 };
+    std::vector<int>         col_index;
+    std::vector<double>      values;
+    col_index.reserve(num_of_row * nnz_per_row * 5 / 4);
+    values.reserve(num_of_row * nnz_per_row * 5 / 4);
+    for (std::size_t row = 0; row < num_of_row; ++row) {
+        std::size_t num = (row % 64 == 0) ? nnz_per_row * 16 : nnz_per_row;
+        std::size_t beg = col_index.size();
+        for (std::size_t idx = 0; idx < num; ++idx) {
+            col_index.push_back(static_cast<int>(gen() % num_of_col));
+        }
+        std::sort(col_index.begin() + beg, col_index.end());
+        col_index.erase(std::unique(col_index.begin() + beg, col_index.end()), col_index.end());
+        values.resize(col_index.size(), 0.5);
+        row_ptr.push_back(col_index.size());
+    }
+    return { num_of_row, num_of_col, std::move(row_ptr), std::move(col_index), std::move(values) };
+}
+
+void SparseMatrixBench(std::size_t num_of_row = 1'000'000, std::size_t nnz_per_row = 16) {
+    Tool::bench_title_info("Sparse_Matrix");
+
+    DS::CSRMatrix<double> csr = random_sparse(num_of_row, num_of_row, nnz_per_row);
+    DS::CSCMatrix<double> csc = csr.convert();
+
+    std::vector<double> x(num_of_row, 1.0);
+    std::vector<double> y(num_of_row);
+    double              checksum = 0;
+    double              ms       = 0;
+
+    // value + index per non-zero
+    const double num_of_byte = static_cast<double>(csr.get_nnz()) * (sizeof(double) + sizeof(int));
+    std::cout << "nnz : " << csr.get_nnz() << std::endl;
+
+    // baseline => 0-based coordinate triples, the `SparseMatrix` layout
+    {
+        std::vector<DS::ElementInfo<double>> triples;
+        triples.reserve(csr.get_nnz());
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            for (std::size_t pos = csr.get_ptr()[row]; pos < csr.get_ptr()[row + 1]; ++pos) {
+                triples.emplace_back(static_cast<int>(row), csr.get_indexes()[pos], csr.get_values()[pos]);
+            }
+        }
+        ms = Tool::time_it([&] {
+            std::fill(y.begin(), y.end(), 0.0);
+            for (const auto& curr : triples) {
+                y[curr.Row] += curr.Value * x[curr.Col];
+            }
+        });
+        checksum += y[0];
+        Tool::bench_throughput_info("coordinate triples", ms, num_of_byte);
+    }
+
+    for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+        std::string suffix = ", " + std::to_string(num_of_thread) + " threads";
+
+        ms = Tool::time_it([&] { csr.multiply(x, y, num_of_thread); });
+        checksum += y[0];
+        Tool::bench_throughput_info(("CSR (row gather)" + suffix).c_str(), ms, num_of_byte);
+
+        ms = Tool::time_it([&] { csc.multiply(x, y, num_of_thread); });
+        checksum += y[0];
+        Tool::bench_throughput_info(("CSC (col scatter)" + suffix).c_str(), ms, num_of_byte);
+
+        ms = Tool::time_it([&] { csc.multiply_transposed(x, y, num_of_thread); });
+        checksum += y[0];
+        Tool::bench_throughput_info(("CSC, transposed (gather)" + suffix).c_str(), ms, num_of_byte);
+    }
+
+    // FEM-like block structure => CSR vs BSR with the matching block size
+    for (std::size_t block : { 4, 8 }) {
+        std::size_t                num_of_node = num_of_row / 8 / block;
+        std::mt19937_64            gen(block);
+        DS::TripletBuilder<double> builder(num_of_node * block, num_of_node * block);
+        for (std::size_t node = 0; node < num_of_node; ++node) {
+            for (std::size_t idx = 0; idx < 8; ++idx) {
+                std::size_t other = (idx == 0) ? node : gen() % num_of_node;
+                for (std::size_t pos = 0; pos < block * block; ++pos) {
+                    builder.add(node * block + pos / block, other * block + pos % block, 0.5);
+                }
+            }
+        }
+        DS::CSRMatrix<double> fem   = builder.build();
+        std::vector<double>   fem_x(fem.get_num_of_col(), 1.0);
+        std::vector<double>   fem_y(fem.get_num_of_row());
+        const double          fem_byte = static_cast<double>(fem.get_nnz()) * (sizeof(double) + sizeof(int));
+        std::string           suffix   = ", " + std::to_string(block) + "x" + std::to_string(block) + " blocks";
+
+        ms = Tool::time_it([&] { fem.multiply(fem_x, fem_y); });
+        checksum += fem_y[0];
+        Tool::bench_throughput_info(("CSR" + suffix).c_str(), ms, fem_byte);
+        if (block == 4) {
+            auto bsr = DS::BSRMatrix<double, 4>::FromCSR(fem);
+            ms       = Tool::time_it([&] { bsr.multiply(fem_x, fem_y); });
+        } else {
+            auto bsr = DS::BSRMatrix<double, 8>::FromCSR(fem);
+            ms       = Tool::time_it([&] { bsr.multiply(fem_x, fem_y); });
+        }
+        checksum += fem_y[0];
+        Tool::bench_throughput_info(("BSR" + suffix).c_str(), ms, fem_byte);
+    }
+
+    // SpGEMM => A * A on a smaller matrix (~64 flops per row => hash accumulator)
+    {
+        DS::CSRMatrix<double> small = random_sparse(num_of_row / 8, num_of_row / 8, nnz_per_row / 2);
+        for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+            std::string           suffix = ", " + std::to_string(num_of_thread) + " threads";
+            DS::CSRMatrix<double> res;
+            ms = Tool::time_it([&] { res = DS::SparseArithmetic::multiply(small, small, num_of_thread); });
+            checksum += static_cast<double>(res.get_nnz());
+            Tool::bench_case_info(("SpGEMM A * A" + suffix).c_str(), ms);
+
+            ms = Tool::time_it([&] { res = DS::SparseArithmetic::add(csr, csr, num_of_thread); });
+            checksum += static_cast<double>(res.get_nnz());
+            Tool::bench_case_info(("sparse A + A" + suffix).c_str(), ms);
+        }
+    }
+
+    // transposes of the triples, `col_traverse_transpose` is O(cols * nnz)
+    // => all four on a small matrix, the other three at full size
+    for (std::size_t size : { num_of_row / 500, num_of_row }) {
+        DS::SparseMatrix<double> origin = DS::SparseMatrix<double>::FromCSR(
+            size == num_of_row ? csr : random_sparse(size, size, nnz_per_row)
+        );
+        std::string suffix = " (" + std::to_string(origin.get_data().size()) + " nnz)";
+
+        ms = Tool::time_it([&] { checksum += origin.fast_transpose().get_data().size(); });
+        Tool::bench_case_info(("fast_transpose" + suffix).c_str(), ms);
+        ms = Tool::time_it([&] { checksum += origin.modern_fast_transpose().get_data().size(); });
+        Tool::bench_case_info(("modern_fast_transpose" + suffix).c_str(), ms);
+        if (size != num_of_row) {
+            ms = Tool::time_it([&] { checksum += origin.col_traverse_transpose().get_data().size(); });
+            Tool::bench_case_info(("col_traverse_transpose" + suffix).c_str(), ms);
+        }
+        for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+            std::string name = "parallel, " + std::to_string(num_of_thread) + " threads" + suffix;
+            ms = Tool::time_it([&] { checksum += origin.parallel_transpose(num_of_thread).get_data().size(); });
+            Tool::bench_case_info(name.c_str(), ms);
+        }
+    }
+    // CSR => CSC, counting sort vs two-pass radix
+    for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+        std::string suffix = ", " + std::to_string(num_of_thread) + " threads";
+
+        ms = Tool::time_it([&] { checksum += csr.convert(num_of_thread).get_nnz(); });
+        Tool::bench_case_info(("CSR => CSC, counting sort" + suffix).c_str(), ms);
+        ms = Tool::time_it([&] { checksum += csr.convert_radix(num_of_thread).get_nnz(); });
+        Tool::bench_case_info(("CSR => CSC, radix" + suffix).c_str(), ms);
+    }
+
+    // AoS triples vs SoA with 32-bit and 16-bit indexes (<= 65536 rows)
+    {
+        auto aos    = DS::SparseMatrix<double>::FromCSR(random_sparse(60'000, 60'000, 64));
+        auto wide   = aos.to_coordinate<std::int32_t>();
+        auto narrow = aos.to_coordinate<std::uint16_t>();
+        std::cout << "bytes per non-zero : AoS " << sizeof(DS::ElementInfo<double>) << ", SoA 32-bit "
+                  << decltype(wide)::BytesOfNonZero << ", SoA 16-bit " << decltype(narrow)::BytesOfNonZero
+                  << std::endl;
+
+        ms = Tool::time_it([&] { checksum += aos.fast_transpose().get_data().size(); });
+        Tool::bench_case_info("transpose, AoS triples", ms);
+        ms = Tool::time_it([&] { checksum += wide.transpose().get_nnz(); });
+        Tool::bench_case_info("transpose, SoA 32-bit", ms);
+        ms = Tool::time_it([&] { checksum += narrow.transpose().get_nnz(); });
+        Tool::bench_case_info("transpose, SoA 16-bit", ms);
+        ms = Tool::time_it([&] { checksum += aos.to_coordinate<std::int32_t>().if_valid(); });
+        Tool::bench_case_info("AoS => SoA 32-bit + validate", ms);
+        ms = Tool::time_it([&] { checksum += narrow.if_valid(); });
+        Tool::bench_case_info("validate, SoA 16-bit", ms);
+    }
+
+    // loading => shuffled triplets through the builder, and a .mtx file
+    {
+        DS::CSRMatrix<double>      part = random_sparse(num_of_row / 4, num_of_row / 4, nnz_per_row);
+        DS::TripletBuilder<double> builder(part.get_num_of_row(), part.get_num_of_col());
+        std::vector<std::size_t>   order(part.get_num_of_row());
+        std::mt19937_64            gen(1);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), gen);
+        builder.reserve(part.get_nnz());
+        for (std::size_t row : order) {
+            for (std::size_t pos = part.get_ptr()[row]; pos < part.get_ptr()[row + 1]; ++pos) {
+                builder.add(row, part.get_indexes()[pos], part.get_values()[pos]);
+            }
+        }
+        for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+            std::string name = "triplet build, " + std::to_string(num_of_thread) + " threads";
+            ms = Tool::time_it([&] {
+                checksum += builder.build(DS::TripletBuilder<double>::Duplicate::Sum, num_of_thread).get_nnz();
+            });
+            Tool::bench_case_info(name.c_str(), ms);
+        }
+
+        const std::string path = "sparse_matrix_bench.mtx";
+        ms = Tool::time_it([&] { DS::MatrixMarket::save(path, part); });
+        const double file_size = static_cast<double>(Tool::MappedFile(path).get_size());
+        Tool::bench_throughput_info("save .mtx", ms, file_size);
+        for (unsigned num_of_thread : { 1u, Tool::num_of_worker() }) {
+            std::string name = "load .mtx, " + std::to_string(num_of_thread) + " threads";
+            ms = Tool::time_it([&] { checksum += DS::MatrixMarket::load<double>(path, num_of_thread).get_nnz(); });
+            Tool::bench_throughput_info(name.c_str(), ms, file_size);
+        }
+        std::remove(path.c_str());
+    }
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("Sparse_Matrix");
+}
+
+} // namespace Bench
@@ -0,0 +1,59 @@
+/**
+ * @file SymbolHistogramBench.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Byte histogram, one table vs interleaved tables vs threads
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/SymbolHistogram.hpp"
+#include "../../tools/BenchTool.hpp"
+#include "HuffmanCodecBench.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+void SymbolHistogramBench(const std::string& corpus_path = "", std::size_t synthetic_size = 256 << 20) {
+    Tool::bench_title_info("Symbol_Histogram");
+
+    std::vector<std::uint8_t> corpus = load_corpus(corpus_path, synthetic_size);
+    std::vector<std::uint8_t> runs(corpus.size(), 'x'); // worst case for one table
+
+    std::uint64_t checksum = 0;
+    double        ms       = 0;
+
+    for (auto* data : { &corpus, &runs }) {
+        std::string suffix = (data == &corpus) ? " (text)" : " (one symbol)";
+
+        ms = Tool::time_it([&] {
+            DS::SymbolHistogram::ByteCounts counts {};
+            for (std::uint8_t byte : *data) {
+                ++counts[byte];
+            }
+            checksum += counts['x'];
+        });
+        Tool::bench_throughput_info(("one table" + suffix).c_str(), ms, data->size());
+        for (unsigned num_of_thread : { 1u, 4u }) {
+            ms = Tool::time_it([&] {
+                checksum += DS::SymbolHistogram::count_bytes(*data, num_of_thread)['x'];
+            });
+            std::string name = "interleaved, " + std::to_string(num_of_thread) + " threads" + suffix;
+            Tool::bench_throughput_info(name.c_str(), ms, data->size());
+        }
+    }
+
+    std::cout << "checksum : " << checksum << std::endl;
+    std::cout << std::endl;
+
+    Tool::bench_end_info("Symbol_Histogram");
+}
+
+} // namespace Bench
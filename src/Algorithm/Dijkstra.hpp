@@ -19,7 +19,6 @@
 #include <list>
 #include <stdexcept>
 #include <type_traits>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -37,8 +36,8 @@ class Dijkstra {
     std::vector<int> Flag; // flag ( 0 or 1 )
     std::vector<int> Adj;  // Adj index
 
-    std::unordered_map<T, std::list<T>> MinRoute;
-    std::unordered_set<int>             NoRouteIdx;
+    std::vector<std::list<T>> MinRoute; // by index of the end
+    std::unordered_set<int>   NoRouteIdx;
 
     int find_closest_unjoined_idx() {
         int closest_idx = 0;
@@ -123,10 +122,7 @@ public:
         ret.Data->make_sure_non_empty();
         ret.Data->make_sure_weighted();
         // init Path
-        for (int idx = 0; idx < graph.size; ++idx) {
-            T vex = graph.Index_V_Map[idx];
-            ret.MinRoute.insert(std::make_pair(vex, std::list<T>()));
-        }
+        ret.MinRoute = std::vector<std::list<T>>(graph.size);
         return ret;
     }
     explicit Dijkstra<T>(DS::Graph<T>& graph)
@@ -134,16 +130,13 @@ public:
         , size(graph.size) {
         Data->make_sure_non_empty();
         Data->make_sure_weighted();
-        for (int idx = 0; idx < graph.size; ++idx) {
-            T vex = graph.Index_V_Map[idx];
-            MinRoute.insert(std::make_pair(vex, std::list<T>()));
-        }
+        MinRoute = std::vector<std::list<T>>(graph.size);
     }
     void execute_algorithm_from_source(const T& source) {
         // check
         Data->make_sure_has_vex(source);
         // bound
-        const int& source_idx = Data->V_Index_Map[source];
+        const int& source_idx = Data->V_Index_Map.at(source);
         this->source_idx      = source_idx;
         this->source          = source;
         // 0. allocate space
@@ -151,9 +144,10 @@ public:
         Dist = std::vector<int>(Data->size);
         Flag = std::vector<int>(Data->size, 0);
         // 1. init Dist
+        std::vector<int> source_row = Data->get_cost_row(source_idx);
         for (int idx = 0; idx < Data->size; ++idx) {
-            Dist[idx] = Data->Mat[source_idx][idx];
-            Adj[idx]  = (Data->Mat[source_idx][idx] == Data->LIM) ? -1 : source_idx;
+            Dist[idx] = source_row[idx];
+            Adj[idx]  = (source_row[idx] == Data->LIM) ? -1 : source_idx;
         }
         // 2. init flag
         Flag[source_idx] = 1;
@@ -168,10 +162,11 @@ public:
             // if (source_to_passed == Data->LIM) {
             //     continue;
             // }
-            // 3) update all other dist
-            for (int curr = 0; curr < Data->size; ++curr) {
+            // 3) update the dist of all adj (the others are LIM away)
+            for (const auto& arc : Data->OutAdj[passed]) {
+                int curr           = arc.To;
                 int source_to_curr = Dist[curr];
-                int passed_to_curr = Data->Mat[passed][curr];
+                int passed_to_curr = arc.Weight;
                 // source->passed->curr < source-->curr
                 bool if_unvisited = Flag[curr] == 0;
                 bool if_closer    = if_closer_judger(
@@ -191,8 +186,7 @@ public:
         }
         // 4. update the Path
         for (int end_idx = 0; end_idx < size; ++end_idx) {
-            T&            end_vex = Data->Index_V_Map[end_idx];
-            std::list<T>& curr    = MinRoute.at(end_vex);
+            std::list<T>& curr = MinRoute[end_idx];
 
             int  trace_back_idx        = end_idx;
             bool if_no_route_to_source = false;
@@ -220,9 +214,8 @@ public:
             if (NoRouteIdx.contains(end_idx)) {
                 continue;
             }
-            T&            end_vex = Data->Index_V_Map[end_idx];
-            std::list<T>& curr    = MinRoute.at(end_vex);
-            curr.push_back(end_vex);
+            std::list<T>& curr = MinRoute[end_idx];
+            curr.push_back(Data->Index_V_Map[end_idx]);
         }
     }
     void show_all_min_dist() {
@@ -241,7 +234,7 @@ public:
     void show_all_min_route() {
         for (int end_idx = 0; end_idx < size; ++end_idx) {
             T&            end_vex    = Data->Index_V_Map[end_idx];
-            std::list<T>& curr_route = MinRoute.at(end_vex);
+            std::list<T>& curr_route = MinRoute[end_idx];
             std::cout << "{ " << source << " -> " << end_vex << " } min route : ";
             std::for_each(
                 curr_route.begin(),
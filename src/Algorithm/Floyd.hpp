@@ -18,7 +18,6 @@
 #include <list>
 #include <stdexcept>
 #include <type_traits>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -48,8 +47,8 @@ class Floyd {
     Matrix<int> Dist;
     Matrix<int> Adj;
 
-    std::unordered_map<IntPair, VexList, IntPairHash> AllMinRoute;
-    std::unordered_set<IntPair, IntPairHash>          NoRouteIdxPair;
+    Matrix<VexList>                          AllMinRoute; // [source][end]
+    std::unordered_set<IntPair, IntPairHash> NoRouteIdxPair;
 
 private:
     bool if_closer_judger(
@@ -90,11 +89,13 @@ public:
         Data->make_sure_weighted();
         Data->make_sure_directed();
         // init `Adj` and `Dist`
-        Dist = Matrix<int>(size, SubMatrix<int>(size, 0));
-        Adj  = Matrix<int>(size, SubMatrix<int>(size, 0));
+        Dist        = Matrix<int>(size, SubMatrix<int>(size, 0));
+        Adj         = Matrix<int>(size, SubMatrix<int>(size, 0));
+        AllMinRoute = Matrix<VexList>(size, SubMatrix<VexList>(size));
         for (int source = 0; source < size; ++source) {
+            std::vector<int> source_row = Data->get_cost_row(source);
             for (int end = 0; end < size; ++end) {
-                int source_to_end = Data->Mat[source][end];
+                int source_to_end = source_row[end];
                 Dist[source][end] = source_to_end;
                 if (source_to_end != Data->LIM) {
                     Adj[source][end] = source;
@@ -111,7 +112,7 @@ public:
                 T&   end_vex    = Data->Index_V_Map[end];
                 T&   source_vex = Data->Index_V_Map[source];
 
-                std::list<T>& curr_route = AllMinRoute[key_pair];
+                std::list<T>& curr_route = AllMinRoute[source][end];
 
                 int  trace_back_idx        = end;
                 bool if_no_route_to_source = false;
@@ -136,7 +137,7 @@ public:
                     continue;
                 }
                 T&            end_vex    = Data->Index_V_Map[end];
-                std::list<T>& curr_route = AllMinRoute.at(key_pair);
+                std::list<T>& curr_route = AllMinRoute[source][end];
                 curr_route.push_back(end_vex);
             }
         }
@@ -180,11 +181,10 @@ public:
     void show_all_min_route() {
         for (int source = 0; source < size; ++source) {
             for (int end = 0; end < size; ++end) {
-                auto key_pair = std::make_pair(source, end);
-                T&   src      = Data->Index_V_Map[source];
-                T&   ed       = Data->Index_V_Map[end];
+                T& src = Data->Index_V_Map[source];
+                T& ed  = Data->Index_V_Map[end];
 
-                std::list<T>& curr_route = AllMinRoute.at(key_pair);
+                std::list<T>& curr_route = AllMinRoute[source][end];
                 std::cout << "{ " << src << " -> " << ed << " } min route : ";
                 std::for_each(
                     curr_route.begin(),
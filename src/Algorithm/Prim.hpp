@@ -95,7 +95,7 @@ public:
         // check
         Data->make_sure_has_vex(source);
         // bound
-        const int& source_idx = Data->V_Index_Map[source];
+        const int& source_idx = Data->V_Index_Map.at(source);
         this->source_idx      = source_idx;
         this->source          = source;
         // 0. allocate space
@@ -103,9 +103,10 @@ public:
         LowCost = std::vector<int>(Data->size);
         Flag    = std::vector<int>(Data->size, 0);
         // 1. init Dist
+        std::vector<int> source_row = Data->get_cost_row(source_idx);
         for (int idx = 0; idx < Data->size; ++idx) {
-            LowCost[idx] = Data->Mat[source_idx][idx];
-            Adj[idx]     = (Data->Mat[source_idx][idx] == Data->LIM) ? -1 : source_idx;
+            LowCost[idx] = source_row[idx];
+            Adj[idx]     = (source_row[idx] == Data->LIM) ? -1 : source_idx;
         }
         // 2. init flag
         Flag[source_idx] = 1;
@@ -116,10 +117,11 @@ public:
             int joined = find_closest_unjoined_idx(); // for loop
             // 2) set visited
             Flag[joined] = 1;
-            // 3) update all other dist
-            for (int curr = 0; curr < Data->size; ++curr) {
-                int  source_to_curr = Data->Mat[source_idx][curr];
-                int  joined_to_curr = Data->Mat[joined][curr];
+            // 3) update the dist of all adj (the others are LIM away)
+            for (const auto& arc : Data->OutAdj[joined]) {
+                int  curr           = arc.To;
+                int  source_to_curr = source_row[curr];
+                int  joined_to_curr = arc.Weight;
                 bool if_unvisited   = Flag[curr] == 0;
                 bool if_closer      = if_closer_judger(
                     joined_to_curr,
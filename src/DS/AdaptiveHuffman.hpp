@@ -0,0 +1,255 @@
+/**
+ * @file AdaptiveHuffman.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Adaptive (FGK) Huffman coding, single pass, bounded memory
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "HuffmanCodec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b AdaptiveHuffmanTree (FGK)
+/// encoder and decoder own one each and call `update` after every symbol,
+/// so both trees stay identical without ever sending a code table.
+/// nodes are numbered (array index) so that weights never decrease with
+/// the number, the root has the highest one => sibling property.
+/// symbols are bytes plus `EndOfStream`, a new one is sent as the NYT
+/// (not yet transmitted) code followed by `RawBits` raw bits.
+class AdaptiveHuffmanTree {
+public:
+    static constexpr int NumOfSymbol = 257;
+    static constexpr int EndOfStream = 256;
+    static constexpr int RawBits     = 9;
+
+    /// @brief once the root reaches this weight the model starts over,
+    /// which bounds the weights and lets the code follow drifting data
+    static constexpr std::uint32_t DefaultWeightLimit = 1 << 16;
+
+private:
+    static constexpr int MaxNode = 2 * NumOfSymbol + 1; // leaves + internals + NYT
+    static constexpr int Root    = MaxNode - 1;
+    static constexpr int Null    = -1;
+
+    struct Node {
+        std::uint32_t weight = 0;
+        int           parent = Null;
+        int           left   = Null;
+        int           right  = Null;
+        int           symbol = Null; // Null => internal or NYT
+    };
+
+    std::array<Node, MaxNode>    Nodes {};
+    std::array<int, NumOfSymbol> LeafOf {};
+
+    int           nyt          = Root;
+    std::uint32_t weight_limit = DefaultWeightLimit;
+
+    bool if_leaf(int idx) const { return Nodes[idx].left == Null; }
+
+    /// @brief swap the sub trees at two numbers, numbers stay in place
+    void interchange(int lhs, int rhs) {
+        std::swap(Nodes[lhs].left, Nodes[rhs].left);
+        std::swap(Nodes[lhs].right, Nodes[rhs].right);
+        std::swap(Nodes[lhs].symbol, Nodes[rhs].symbol);
+        for (int idx : { lhs, rhs }) {
+            Node& node = Nodes[idx];
+            if (node.left != Null) {
+                Nodes[node.left].parent  = idx;
+                Nodes[node.right].parent = idx;
+            } else if (node.symbol != Null) {
+                LeafOf[node.symbol] = idx;
+            } else {
+                nyt = idx;
+            }
+        }
+    }
+    /// @brief highest numbered node (leaf only, if asked) of the same weight
+    int block_leader(int idx, bool if_leaf_only) const {
+        int res = idx;
+        for (int curr = idx + 1; curr < MaxNode && Nodes[curr].weight == Nodes[idx].weight; ++curr) {
+            if (!if_leaf_only || if_leaf(curr)) {
+                res = curr;
+            }
+        }
+        return res;
+    }
+
+public:
+    explicit AdaptiveHuffmanTree(std::uint32_t weight_limit = DefaultWeightLimit)
+        : weight_limit(weight_limit) {
+        reset();
+    }
+
+    void reset() {
+        Nodes.fill(Node {});
+        LeafOf.fill(Null);
+        nyt = Root;
+    }
+
+    bool if_known(int symbol) const { return LeafOf[symbol] != Null; }
+    int  get_nyt() const { return nyt; }
+    int  get_leaf(int symbol) const { return LeafOf[symbol]; }
+    int  get_root() const { return Root; }
+    int  get_child(int idx, int bit) const { return bit ? Nodes[idx].right : Nodes[idx].left; }
+    int  get_symbol(int idx) const { return Nodes[idx].symbol; }
+    int  get_parent(int idx) const { return Nodes[idx].parent; }
+    bool if_right_child(int idx) const { return Nodes[Nodes[idx].parent].right == idx; }
+    bool if_leaf_node(int idx) const { return if_leaf(idx); }
+
+    /// @brief @b update (FGK), called after coding `symbol`
+    void update(int symbol) {
+        int node = LeafOf[symbol];
+        if (node == Null) {
+            // NYT => internal node, new NYT on the left, new leaf on the right
+            int old_nyt = nyt;
+            int leaf    = old_nyt - 1;
+            nyt         = old_nyt - 2;
+
+            Nodes[old_nyt].left  = nyt;
+            Nodes[old_nyt].right = leaf;
+            Nodes[leaf]          = Node { 0, old_nyt, Null, Null, symbol };
+            Nodes[nyt]           = Node { 0, old_nyt, Null, Null, Null };
+            LeafOf[symbol]       = leaf;
+            node                 = leaf;
+        }
+        // sibling of the NYT => its parent has the same weight,
+        // only leaves may be interchanged here
+        if (node != Root && Nodes[Nodes[node].parent].left == nyt) {
+            int leader = block_leader(node, true);
+            if (leader != node) {
+                interchange(node, leader);
+                node = leader;
+            }
+            ++Nodes[node].weight;
+            node = Nodes[node].parent;
+        }
+        while (node != Root) {
+            int leader = block_leader(node, false);
+            if (leader != node && leader != Nodes[node].parent) {
+                interchange(node, leader);
+                node = leader;
+            }
+            ++Nodes[node].weight;
+            node = Nodes[node].parent;
+        }
+        ++Nodes[Root].weight;
+
+        if (Nodes[Root].weight >= weight_limit) {
+            reset();
+        }
+    }
+};
+
+/// @brief @b AdaptiveHuffmanEncoder, one pass, `encode` on consecutive chunks
+class AdaptiveHuffmanEncoder {
+    AdaptiveHuffmanTree Tree;
+    BitWriter           Writer;
+
+    /// @brief bits on the way from the root, at most one per node
+    void write_path(int node) {
+        std::array<std::uint8_t, 2 * AdaptiveHuffmanTree::NumOfSymbol + 1> path;
+        int                                                               length = 0;
+        while (node != Tree.get_root()) {
+            path[length++] = Tree.if_right_child(node);
+            node           = Tree.get_parent(node);
+        }
+        while (length > 0) {
+            // up to 32 bits per write, root first
+            int           chunk = std::min(length, 32);
+            std::uint64_t bits  = 0;
+            for (int i = 0; i < chunk; ++i) {
+                bits = (bits << 1) | path[--length];
+            }
+            Writer.write(bits, chunk);
+        }
+    }
+    void encode_symbol(int symbol) {
+        if (Tree.if_known(symbol)) {
+            write_path(Tree.get_leaf(symbol));
+        } else {
+            write_path(Tree.get_nyt());
+            Writer.write(static_cast<std::uint64_t>(symbol), AdaptiveHuffmanTree::RawBits);
+        }
+        Tree.update(symbol);
+    }
+
+public:
+    explicit AdaptiveHuffmanEncoder(
+        std::vector<std::uint8_t>& out,
+        std::uint32_t              weight_limit = AdaptiveHuffmanTree::DefaultWeightLimit
+    )
+        : Tree(weight_limit)
+        , Writer(out) { }
+
+    void encode(std::span<const std::uint8_t> in) {
+        for (std::uint8_t symbol : in) {
+            encode_symbol(symbol);
+        }
+    }
+    /// @brief sends `EndOfStream`, the decoder needs no length
+    void finish() {
+        encode_symbol(AdaptiveHuffmanTree::EndOfStream);
+        Writer.flush();
+    }
+};
+
+/// @brief @b AdaptiveHuffmanDecoder
+class AdaptiveHuffmanDecoder {
+    AdaptiveHuffmanTree Tree;
+
+public:
+    explicit AdaptiveHuffmanDecoder(std::uint32_t weight_limit = AdaptiveHuffmanTree::DefaultWeightLimit)
+        : Tree(weight_limit) { }
+
+    /// @brief decode until `EndOfStream`, symbols are appended to `out`
+    void decode(std::span<const std::uint8_t> in, std::vector<std::uint8_t>& out) {
+        BitReader reader(in);
+        int       num_of_bits = 0; // consumed since the last refill
+        auto      read_bits   = [&](int length) {
+            if (num_of_bits + length > 56) {
+                reader.refill();
+                num_of_bits = 0;
+            }
+            std::uint64_t res = reader.peek(length);
+            reader.consume(length);
+            num_of_bits += length;
+            return res;
+        };
+        reader.refill();
+        while (true) {
+            int node = Tree.get_root();
+            while (!Tree.if_leaf_node(node)) {
+                node = Tree.get_child(node, static_cast<int>(read_bits(1)));
+            }
+            int symbol = (node == Tree.get_nyt())
+                ? static_cast<int>(read_bits(AdaptiveHuffmanTree::RawBits))
+                : Tree.get_symbol(node);
+            if (reader.if_overrun() || symbol >= AdaptiveHuffmanTree::NumOfSymbol) {
+                throw std::runtime_error("Broken adaptive Huffman stream. ");
+            }
+            if (symbol == AdaptiveHuffmanTree::EndOfStream) {
+                return;
+            }
+            out.push_back(static_cast<std::uint8_t>(symbol));
+            Tree.update(symbol);
+        }
+    }
+};
+
+} // namespace DS
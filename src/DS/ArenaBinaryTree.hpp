@@ -0,0 +1,387 @@
+/**
+ * @file ArenaBinaryTree.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief BinaryTree with all nodes in one contiguous arena (index based)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "BinaryTree.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b ArenaBinaryTree
+/// nodes are stored in one `std::vector`, linked by 32-bit indexes
+/// @tparam KeepParent store the parent index => `Parent()` is O(1)
+template <typename T, bool KeepParent = true>
+class ArenaBinaryTree {
+public:
+    using ElemType = T;
+    using Index    = std::uint32_t;
+
+    static constexpr Index Null = UINT32_MAX;
+
+private:
+    struct NoParent { };
+    using ParentType = std::conditional_t<KeepParent, Index, NoParent>;
+
+    struct Node {
+        T     elem {};
+        Index left  = Null;
+        Index right = Null;
+
+        [[no_unique_address]] ParentType parent {};
+    };
+
+    std::vector<Node>  Nodes;
+    std::vector<Index> FreeList; // slots of deleted nodes, reused first
+    Index              TheRoot = Null;
+    int                size    = 0;
+
+    Index new_node(const T& elem, Index parent) {
+        Index idx = Null;
+        if (!FreeList.empty()) {
+            idx = FreeList.back();
+            FreeList.pop_back();
+            Nodes[idx] = Node {};
+        } else {
+            if (Nodes.size() >= Null) {
+                throw std::length_error("ArenaBinaryTree is full!");
+            }
+            idx = static_cast<Index>(Nodes.size());
+            Nodes.emplace_back();
+        }
+        Nodes[idx].elem = elem;
+        if constexpr (KeepParent) {
+            Nodes[idx].parent = parent;
+        }
+        ++size;
+        return idx;
+    }
+    void make_sure_valid(Index idx) const {
+        if (idx == Null || idx >= Nodes.size()) {
+            throw std::runtime_error("Input node is NULL. ");
+        }
+    }
+
+public:
+    /// @brief @b constructor => an empty tree, nodes could be reserved
+    ArenaBinaryTree() = default;
+    explicit ArenaBinaryTree(int capacity) {
+        Nodes.reserve(capacity);
+    }
+
+    /// @brief @b conversion_from_pointer_based_BinaryTree (pre-order layout)
+    static ArenaBinaryTree FromBinaryTree(BinaryTree<T>& tree) {
+        ArenaBinaryTree res(tree.BiTreeSize());
+        auto*           root = tree.Root();
+        if (!root) {
+            return res;
+        }
+        res.TheRoot = res.new_node(root->elem, Null);
+        // (pointer node, arena index)
+        std::vector<std::pair<decltype(root), Index>> stack;
+        stack.emplace_back(root, res.TheRoot);
+        while (!stack.empty()) {
+            auto [node, idx] = stack.back();
+            stack.pop_back();
+            if (node->right) {
+                Index right          = res.new_node(node->right->elem, idx);
+                res.Nodes[idx].right = right;
+                stack.emplace_back(node->right, right);
+            }
+            if (node->left) {
+                Index left          = res.new_node(node->left->elem, idx);
+                res.Nodes[idx].left = left;
+                stack.emplace_back(node->left, left);
+            }
+        }
+        return res;
+    }
+
+    /// @brief @b create_binary_tree (level order, "#" for NULL)
+    static ArenaBinaryTree CreateBiTree(const std::vector<std::string>& data)
+    requires std::is_same_v<T, int> // only support int
+    {
+        ArenaBinaryTree res(static_cast<int>(data.size()));
+        if (data.empty() || data.front() == "#") {
+            return res;
+        }
+        res.TheRoot = res.new_node(std::stoi(data.front()), Null);
+
+        std::vector<Index> parents { res.TheRoot };
+        std::size_t        parent_pos = 0;
+        bool               if_left    = true;
+        for (std::size_t pos = 1; pos < data.size(); ++pos) {
+            Index parent = parents[parent_pos];
+            if (data[pos] != "#") {
+                Index child = res.new_node(std::stoi(data[pos]), parent);
+                (if_left ? res.Nodes[parent].left : res.Nodes[parent].right) = child;
+                parents.push_back(child);
+            }
+            if (!if_left) {
+                ++parent_pos;
+                if (parent_pos == parents.size()) {
+                    break;
+                }
+            }
+            if_left = !if_left;
+        }
+        return res;
+    }
+
+    /// @brief @b size_related
+    bool BiTreeEmpty() const { return TheRoot == Null; }
+    int  BiTreeSize() const { return size; }
+    int  BiTreeDepth() const {
+        int res = 0;
+        if (TheRoot == Null) {
+            return 0;
+        }
+        std::vector<Index> level { TheRoot };
+        std::vector<Index> next_level;
+        while (!level.empty()) {
+            ++res;
+            next_level.clear();
+            for (Index idx : level) {
+                if (Nodes[idx].left != Null) {
+                    next_level.push_back(Nodes[idx].left);
+                }
+                if (Nodes[idx].right != Null) {
+                    next_level.push_back(Nodes[idx].right);
+                }
+            }
+            std::swap(level, next_level);
+        }
+        return res;
+    }
+
+    /// @brief @b Node_Relation_Opt
+    Index Root() const { return TheRoot; }
+    T&    Value(Index idx) {
+        make_sure_valid(idx);
+        return Nodes[idx].elem;
+    }
+    Index LeftChild(Index idx) const {
+        make_sure_valid(idx);
+        return Nodes[idx].left;
+    }
+    Index RightChild(Index idx) const {
+        make_sure_valid(idx);
+        return Nodes[idx].right;
+    }
+    Index Parent(Index idx) const {
+        make_sure_valid(idx);
+        if constexpr (KeepParent) {
+            return Nodes[idx].parent;
+        } else {
+            // no parent index => search the whole tree
+            Index res = Null;
+            PreOrderOpt([&](Index curr) {
+                if (Nodes[curr].left == idx || Nodes[curr].right == idx) {
+                    res = curr;
+                }
+            });
+            return res;
+        }
+    }
+    Index LeftBrother(Index idx) const {
+        Index father = Parent(idx);
+        if (father == Null || Nodes[father].left == idx) {
+            return Null;
+        }
+        return Nodes[father].left;
+    }
+    Index RightBrother(Index idx) const {
+        Index father = Parent(idx);
+        if (father == Null || Nodes[father].right == idx) {
+            return Null;
+        }
+        return Nodes[father].right;
+    }
+
+    /// @brief @b Processing
+    Index AddRoot(const T& value) {
+        if (TheRoot != Null) {
+            throw std::runtime_error("Root already exists!");
+        }
+        TheRoot = new_node(value, Null);
+        return TheRoot;
+    }
+    /// @param LR 0 => left, 1 => right
+    Index InsertChild(Index idx, const T& value, int LR = 0) {
+        make_sure_valid(idx);
+        if (LR != 0 && LR != 1) {
+            throw std::runtime_error("Unknown insert position type. ");
+        }
+        Index curr_child = (LR == 0) ? Nodes[idx].left : Nodes[idx].right;
+        if (curr_child != Null) {
+            throw std::runtime_error("Insert position is occupied!");
+        }
+        Index child = new_node(value, idx); // may reallocate `Nodes`
+        (LR == 0 ? Nodes[idx].left : Nodes[idx].right) = child;
+        return child;
+    }
+    /// @brief free the whole sub tree, slots are recycled by later inserts
+    void DeleteChild(Index idx, int LR = 0) {
+        make_sure_valid(idx);
+        if (LR != 0 && LR != 1) {
+            throw std::runtime_error("Unknown delete position type. ");
+        }
+        Index& child = (LR == 0) ? Nodes[idx].left : Nodes[idx].right;
+        PostOrderOpt(child, [this](Index toDelete) {
+            FreeList.push_back(toDelete);
+            --size;
+        });
+        child = Null; // must set to Null
+    }
+    void Clear() {
+        Nodes.clear();
+        FreeList.clear();
+        TheRoot = Null;
+        size    = 0;
+    }
+
+    /// @brief @b Compact => re-layout in pre-order, drop all free slots
+    void Compact() {
+        std::vector<Node>  compacted;
+        std::vector<Index> new_index(Nodes.size(), Null);
+        compacted.reserve(size);
+        PreOrderOpt([&](Index idx) {
+            new_index[idx] = static_cast<Index>(compacted.size());
+            compacted.push_back(Nodes[idx]);
+        });
+        for (Node& node : compacted) {
+            node.left  = (node.left == Null) ? Null : new_index[node.left];
+            node.right = (node.right == Null) ? Null : new_index[node.right];
+            if constexpr (KeepParent) {
+                node.parent = (node.parent == Null) ? Null : new_index[node.parent];
+            }
+        }
+        TheRoot = (TheRoot == Null) ? Null : 0;
+        Nodes   = std::move(compacted);
+        FreeList.clear();
+    }
+
+    /// @brief @b Traverse_Engine => func(Index), any callable
+    template <typename Func>
+    void PreOrderOpt(Index input, Func&& func) const {
+        if (input == Null) {
+            return;
+        }
+        std::vector<Index> opt_stack { input };
+        while (!opt_stack.empty()) {
+            Index idx = opt_stack.back();
+            opt_stack.pop_back();
+            // read the children first, `func` is allowed to drop this node
+            Index left  = Nodes[idx].left;
+            Index right = Nodes[idx].right;
+            func(idx);
+            if (right != Null) {
+                opt_stack.push_back(right);
+            }
+            if (left != Null) {
+                opt_stack.push_back(left);
+            }
+        }
+    }
+    template <typename Func>
+    void InOrderOpt(Index input, Func&& func) const {
+        std::vector<Index> opt_stack;
+        Index              idx = input;
+        while (idx != Null || !opt_stack.empty()) {
+            while (idx != Null) {
+                // All left-sub-tree
+                opt_stack.push_back(idx);
+                idx = Nodes[idx].left;
+            }
+            idx = opt_stack.back(); // trace back
+            opt_stack.pop_back();
+            Index right = Nodes[idx].right;
+            func(idx);
+            // To a right-sub-tree
+            idx = right;
+        }
+    }
+    template <typename Func>
+    void PostOrderOpt(Index input, Func&& func) const {
+        if (input == Null) {
+            return;
+        }
+        // <idx, flag> (flag => 0: finished left, 1: finished left & right)
+        std::vector<std::pair<Index, int>> opt_stack;
+        Index                              idx = input;
+        while (idx != Null || !opt_stack.empty()) {
+            while (idx != Null) {
+                opt_stack.emplace_back(idx, 0);
+                idx = Nodes[idx].left;
+            }
+            auto& [top, flag] = opt_stack.back();
+            if (flag == 0) {
+                flag = 1;
+                idx  = Nodes[top].right;
+            } else {
+                Index done = top;
+                opt_stack.pop_back();
+                func(done);
+                idx = Null;
+            }
+        }
+    }
+    template <typename Func>
+    void LevelOrderOpt(Index input, Func&& func) const {
+        if (input == Null) {
+            return;
+        }
+        std::vector<Index> queue { input }; // indexes before `head` are popped
+        std::size_t        head = 0;
+        while (head < queue.size()) {
+            Index idx = queue[head++];
+            if (Nodes[idx].left != Null) {
+                queue.push_back(Nodes[idx].left);
+            }
+            if (Nodes[idx].right != Null) {
+                queue.push_back(Nodes[idx].right);
+            }
+            func(idx);
+        }
+    }
+    template <typename Func>
+    void PreOrderOpt(Func&& func) const { PreOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void InOrderOpt(Func&& func) const { InOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void PostOrderOpt(Func&& func) const { PostOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void LevelOrderOpt(Func&& func) const { LevelOrderOpt(TheRoot, std::forward<Func>(func)); }
+
+    /// @brief @b Traverse
+    void PreOrderTraverse() const {
+        PreOrderOpt([this](Index idx) { std::cout << Nodes[idx].elem << " "; });
+    }
+    void InOrderTraverse() const {
+        InOrderOpt([this](Index idx) { std::cout << Nodes[idx].elem << " "; });
+    }
+    void PostOrderTraverse() const {
+        PostOrderOpt([this](Index idx) { std::cout << Nodes[idx].elem << " "; });
+    }
+    void LevelOrderTraverse() const {
+        LevelOrderOpt([this](Index idx) { std::cout << Nodes[idx].elem << " "; });
+    }
+};
+
+} // namespace DS
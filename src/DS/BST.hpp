@@ -14,31 +14,83 @@
 #include <algorithm>
 #include <concepts>
 #include <iostream>
+#include <iterator>
 #include <queue>
+#include <ranges>
 #include <stack>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace DS {
 
+/// @brief @b monoids_for_subtree_aggregate
+/// A monoid provides `ValueType`, `identity()`, `lift(elem)` and an
+/// associative `combine(lhs, rhs)` (applied in ascending key order)
 template <typename T>
+struct SumMonoid {
+    using ValueType = std::conditional_t<std::is_integral_v<T>, long long, T>;
+
+    static ValueType identity() { return ValueType {}; }
+    static ValueType lift(const T& elem) { return static_cast<ValueType>(elem); }
+    static ValueType combine(const ValueType& lhs, const ValueType& rhs) { return lhs + rhs; }
+};
+template <typename T>
+struct NoAggregate {
+    struct ValueType { };
+
+    static ValueType identity() { return {}; }
+    static ValueType lift(const T&) { return {}; }
+    static ValueType combine(const ValueType&, const ValueType&) { return {}; }
+};
+template <typename T>
+using DefaultBSTMonoid = std::conditional_t<std::is_arithmetic_v<T>, SumMonoid<T>, NoAggregate<T>>;
+
+template <typename T, typename Monoid = DefaultBSTMonoid<T>>
 requires std::equality_comparable<T>
 class BST {
+public:
+    using AggType = typename Monoid::ValueType;
+
+private:
     struct Node {
         T     elem;
         Node* left  = nullptr;
         Node* right = nullptr;
+        int   count = 1; // size of the sub tree
+
+        [[no_unique_address]] AggType agg {}; // aggregate of the sub tree
 
         Node() = default;
         constexpr explicit Node(const T& elem)
-            : elem(elem) { }
+            : elem(elem)
+            , agg(Monoid::lift(elem)) { }
     };
-    Node* TheRoot  = nullptr;
-    int   size     = 0;
-    using NodePair = std::pair<Node*, Node*>;
+    Node* TheRoot   = nullptr;
+    int   size      = 0;
+    Node* Pool      = nullptr; // contiguous nodes from `from_sorted`
+    int   pool_size = 0;
+    using NodePair  = std::pair<Node*, Node*>;
 
 private:
+    /// @brief @b augmentation
+    static int     count_of(Node* node) { return node ? node->count : 0; }
+    static AggType agg_of(Node* node) { return node ? node->agg : Monoid::identity(); }
+    static void    pull(Node* node) {
+        node->count = 1 + count_of(node->left) + count_of(node->right);
+        node->agg   = Monoid::combine(
+            Monoid::combine(agg_of(node->left), Monoid::lift(node->elem)),
+            agg_of(node->right)
+        );
+    }
+    /// re-compute from the deepest node of `path` up to the root
+    static void pull_path(const std::vector<Node*>& path) {
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            pull(*it);
+        }
+    }
+
     /* < max_node, parent_node > */
     NodePair find_max_and_parent(Node* input, Node* parent) {
         NodePair ret = std::make_pair(nullptr, nullptr);
@@ -62,67 +114,93 @@ private:
         return ret;
     }
 
+    bool if_pooled(Node* node) const {
+        return Pool && node >= Pool && node < Pool + pool_size;
+    }
+    /// @brief pooled nodes are only freed all at once (with the whole pool)
+    void release_node(Node* node) {
+        if (!if_pooled(node)) {
+            delete node;
+        }
+    }
     void delete_tree(Node* toDelete) {
         if (toDelete) {
             delete_tree(toDelete->left);
             delete_tree(toDelete->right);
-            delete toDelete;
+            release_node(toDelete);
             --size;
         }
     }
     void delete_all_node() {
         delete_tree(TheRoot);
+        TheRoot = nullptr;
+        delete[] Pool;
+        Pool      = nullptr;
+        pool_size = 0;
+    }
+
+    /// @brief @b balanced_build => in-order rank `idx` lives in `Pool[idx]`
+    Node* build_balanced(const std::vector<T>& sorted, int beg, int end) {
+        if (beg >= end) {
+            return nullptr;
+        }
+        int   mid   = beg + (end - beg) / 2;
+        Node* node  = &Pool[mid];
+        node->elem  = sorted[mid];
+        node->left  = build_balanced(sorted, beg, mid);
+        node->right = build_balanced(sorted, mid + 1, end);
+        pull(node);
+        return node;
+    }
+    /// `sorted` is trusted to be strictly increasing
+    static BST from_sorted_vector(const std::vector<T>& sorted) {
+        BST res;
+        if (sorted.empty()) {
+            return res;
+        }
+        res.pool_size = static_cast<int>(sorted.size());
+        res.Pool      = new Node[res.pool_size];
+        res.TheRoot   = res.build_balanced(sorted, 0, res.pool_size);
+        res.size      = res.pool_size;
+        return res;
     }
 
 private:
-    void remove_leaf(Node*& toRemove, Node*& parent) {
-        // de-link
-        if (parent->left == toRemove) {
-            parent->left = nullptr;
+    /// @brief re-link the link `parent -> child` (or `TheRoot`) to `replacement`
+    void replace_child(Node* parent, Node* child, Node* replacement) {
+        if (!parent) {
+            TheRoot = replacement;
+        } else if (parent->left == child) {
+            parent->left = replacement;
         } else {
-            parent->right = nullptr;
+            parent->right = replacement;
         }
+    }
+    void remove_leaf(Node*& toRemove, Node*& parent) {
+        // de-link
+        replace_child(parent, toRemove, nullptr);
         // remove
-        delete toRemove;
+        release_node(toRemove);
         --size;
     }
     void remove_single_branch(Node*& toRemove, Node*& parent) {
-        // de-link
-        bool if_removed_left = false;
-        if (parent->left == toRemove) {
-            parent->left    = nullptr;
-            if_removed_left = true;
-        } else {
-            parent->right = nullptr;
-        }
-        // judge
-        bool if_left_branch = toRemove->left != nullptr;
-        // re-link
-        if (if_left_branch) {
-            if (if_removed_left) {
-                parent->left = toRemove->left;
-            } else {
-                parent->right = toRemove->left;
-            }
-        } else {
-            if (if_removed_left) {
-                parent->left = toRemove->right;
-            } else {
-                parent->right = toRemove->right;
-            }
-        }
+        // re-link the only sub tree to parent
+        Node* branch = (toRemove->left) ? toRemove->left : toRemove->right;
+        replace_child(parent, toRemove, branch);
         // delete
-        delete toRemove;
+        release_node(toRemove);
         --size;
     }
-    void remove_double_branch(Node*& toRemove, Node*& parent) {
-        NodePair received = find_max_and_parent(
-            toRemove->left,
-            toRemove
-        );
+    /// @param path root -> toRemove, will be extended to the parent of left_max
+    void remove_double_branch(Node*& toRemove, std::vector<Node*>& path) {
         // get => max_of_left_sub_tree & it's parent
-        Node* left_max           = received.first;
-        Node* parent_of_left_max = received.second;
+        Node* parent_of_left_max = toRemove;
+        Node* left_max           = toRemove->left;
+        while (left_max->right) {
+            path.push_back(left_max);
+            parent_of_left_max = left_max;
+            left_max           = left_max->right;
+        }
         // de-link left-max & re-link left-max's left sub tree
         if (parent_of_left_max != toRemove) {
             parent_of_left_max->right = left_max->left;
@@ -134,69 +212,291 @@ private:
         // toRemove->elem <== left_max->elem [use std::move()]
         toRemove->elem = std::move(left_max->elem);
         // left_max's elem has been moved, delete the node
-        delete left_max;
+        release_node(left_max);
         --size;
     }
-    void remove_node(Node*& toRemove, Node*& parent) {
+    /// @param path root -> toRemove
+    void remove_node(Node*& toRemove, std::vector<Node*>& path) {
+        Node* parent = (path.size() >= 2) ? path[path.size() - 2] : nullptr;
         if (toRemove->left && toRemove->right) {
-            remove_double_branch(toRemove, parent);
-        } else if (!toRemove->left && !toRemove->right) {
-            remove_leaf(toRemove, parent);
+            remove_double_branch(toRemove, path);
         } else {
-            remove_single_branch(toRemove, parent);
+            if (!toRemove->left && !toRemove->right) {
+                remove_leaf(toRemove, parent);
+            } else {
+                remove_single_branch(toRemove, parent);
+            }
+            path.pop_back(); // toRemove is gone
         }
+        pull_path(path);
+    }
+
+    /// @brief @b range_aggregate_helpers (in ascending order)
+    /// aggregate of all elems `>= lo` in the sub tree
+    static AggType agg_not_less(Node* node, const T& lo) {
+        AggType res = Monoid::identity();
+        while (node) {
+            if (node->elem < lo) {
+                node = node->right;
+            } else {
+                res  = Monoid::combine(
+                    Monoid::combine(Monoid::lift(node->elem), agg_of(node->right)),
+                    res
+                );
+                node = node->left;
+            }
+        }
+        return res;
+    }
+    /// aggregate of all elems `<= hi` in the sub tree
+    static AggType agg_not_greater(Node* node, const T& hi) {
+        AggType res = Monoid::identity();
+        while (node) {
+            if (hi < node->elem) {
+                node = node->left;
+            } else {
+                res  = Monoid::combine(
+                    res,
+                    Monoid::combine(agg_of(node->left), Monoid::lift(node->elem))
+                );
+                node = node->right;
+            }
+        }
+        return res;
     }
 
 public:
+    BST() = default;
     ~BST() {
         delete_all_node();
     }
+    BST(const BST&)            = delete;
+    BST& operator=(const BST&) = delete;
+    BST(BST&& moved) noexcept
+        : TheRoot(moved.TheRoot)
+        , size(moved.size)
+        , Pool(moved.Pool)
+        , pool_size(moved.pool_size) {
+        moved.TheRoot   = nullptr;
+        moved.size      = 0;
+        moved.Pool      = nullptr;
+        moved.pool_size = 0;
+    }
+    BST& operator=(BST&& moved) noexcept {
+        if (&moved == this) {
+            return *this;
+        }
+        delete_all_node();
+        TheRoot         = moved.TheRoot;
+        size            = moved.size;
+        Pool            = moved.Pool;
+        pool_size       = moved.pool_size;
+        moved.TheRoot   = nullptr;
+        moved.size      = 0;
+        moved.Pool      = nullptr;
+        moved.pool_size = 0;
+        return *this;
+    }
+
+    /// @brief @b bulk_construction => perfectly balanced, one allocation, O(n)
+    /// `sorted` must be strictly increasing
+    template <std::ranges::input_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    static BST from_sorted(const Range& sorted) {
+        std::vector<T> elems;
+        if constexpr (std::ranges::sized_range<Range>) {
+            elems.reserve(std::ranges::size(sorted));
+        }
+        for (auto&& elem : sorted) {
+            if (!elems.empty() && !(elems.back() < elem)) {
+                throw std::logic_error("Input of `from_sorted` is NOT strictly increasing!");
+            }
+            elems.emplace_back(elem);
+        }
+        return from_sorted_vector(elems);
+    }
+
+    /// @brief @b bulk_merge => in-order flatten, merge, rebuild, O(n + m)
+    static BST set_union(const BST& lhs, const BST& rhs) {
+        std::vector<T> lhs_elems = lhs.to_sorted_vector();
+        std::vector<T> rhs_elems = rhs.to_sorted_vector();
+        std::vector<T> merged;
+        merged.reserve(lhs_elems.size() + rhs_elems.size());
+        std::set_union(
+            lhs_elems.begin(), lhs_elems.end(),
+            rhs_elems.begin(), rhs_elems.end(),
+            std::back_inserter(merged)
+        );
+        return from_sorted_vector(merged);
+    }
+    static BST set_intersection(const BST& lhs, const BST& rhs) {
+        std::vector<T> lhs_elems = lhs.to_sorted_vector();
+        std::vector<T> rhs_elems = rhs.to_sorted_vector();
+        std::vector<T> merged;
+        merged.reserve(std::min(lhs_elems.size(), rhs_elems.size()));
+        std::set_intersection(
+            lhs_elems.begin(), lhs_elems.end(),
+            rhs_elems.begin(), rhs_elems.end(),
+            std::back_inserter(merged)
+        );
+        return from_sorted_vector(merged);
+    }
+
+    /// @brief @b in_order_flatten
+    std::vector<T> to_sorted_vector() const {
+        std::vector<T> res;
+        res.reserve(size);
+        Node*             node = TheRoot;
+        std::stack<Node*> stack;
+        while (node || !stack.empty()) {
+            while (node) {
+                // All left-sub-tree
+                stack.push(node);
+                node = node->left;
+            }
+            node = stack.top(); // trace back
+            stack.pop();
+            res.push_back(node->elem);
+            // To a right-sub-tree
+            node = node->right;
+        }
+        return res;
+    }
     void insert(const T& val) {
-        Node* toInsert = new Node(val);
         if (!TheRoot) {
-            TheRoot = toInsert;
+            TheRoot = new Node(val);
             ++size;
             return;
         }
-        Node* parent  = nullptr;
-        Node* current = TheRoot;
+        std::vector<Node*> path; // root -> parent
+        Node*              current = TheRoot;
         while (current) {
+            path.push_back(current);
             if (val < current->elem) {
-                parent  = current;
                 current = current->left;
             } else if (val > current->elem) {
-                parent  = current;
                 current = current->right;
             } else {
                 return;
             }
         }
+        Node* parent   = path.back();
+        Node* toInsert = new Node(val);
         if (val < parent->elem) {
             parent->left = toInsert;
         } else {
             parent->right = toInsert;
         }
         ++size;
+        pull_path(path);
     }
     void remove(const T& val) {
-        Node* node = TheRoot;
-        if (!node) {
-            return;
+        std::vector<Node*> path; // root -> toRemove
+        Node*              current = TheRoot;
+        while (current) {
+            path.push_back(current);
+            if (val < current->elem) {
+                current = current->left;
+            } else if (val > current->elem) {
+                current = current->right;
+            } else {
+                break;
+            }
+        }
+        if (!current) {
+            return; // not found
         }
-        Node* parent  = nullptr;
+        remove_node(current, path);
+    }
+    bool contains(const T& val) const {
         Node* current = TheRoot;
         while (current) {
             if (val < current->elem) {
-                parent  = current;
                 current = current->left;
             } else if (val > current->elem) {
-                parent  = current;
                 current = current->right;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+    int get_size() const {
+        return size;
+    }
+
+    /// @brief @b order_statistics, O(height)
+    /// k-th smallest elem, `k` starts from 0
+    const T& select(int k) const {
+        if (k < 0 || k >= size) {
+            throw std::out_of_range("Input `k` is out of range!");
+        }
+        Node* node = TheRoot;
+        while (true) {
+            int left_count = count_of(node->left);
+            if (k < left_count) {
+                node = node->left;
+            } else if (k == left_count) {
+                return node->elem;
+            } else {
+                k -= left_count + 1;
+                node = node->right;
+            }
+        }
+    }
+    /// number of elems `< val`
+    int rank(const T& val) const {
+        int   res  = 0;
+        Node* node = TheRoot;
+        while (node) {
+            if (node->elem < val) {
+                res += count_of(node->left) + 1;
+                node = node->right;
+            } else {
+                node = node->left;
+            }
+        }
+        return res;
+    }
+    /// number of elems in `[lo, hi]`
+    int range_count(const T& lo, const T& hi) const {
+        if (hi < lo) {
+            return 0;
+        }
+        int   not_greater_than_hi = 0;
+        Node* node                = TheRoot;
+        while (node) {
+            if (hi < node->elem) {
+                node = node->left;
+            } else {
+                not_greater_than_hi += count_of(node->left) + 1;
+                node = node->right;
+            }
+        }
+        return not_greater_than_hi - rank(lo);
+    }
+    /// `Monoid` aggregate of elems in `[lo, hi]` (a sum by default)
+    AggType range_sum(const T& lo, const T& hi) const
+    requires(!std::is_same_v<Monoid, NoAggregate<T>>)
+    {
+        // locate the split node, where paths to `lo` and `hi` diverge
+        Node* node = TheRoot;
+        while (node) {
+            if (node->elem < lo) {
+                node = node->right;
+            } else if (hi < node->elem) {
+                node = node->left;
             } else {
                 break;
             }
         }
-        remove_node(current, parent);
+        if (!node) {
+            return Monoid::identity();
+        }
+        return Monoid::combine(
+            Monoid::combine(agg_not_less(node->left, lo), Monoid::lift(node->elem)),
+            agg_not_greater(node->right, hi)
+        );
     }
     void print_tree() {
         Node* node = TheRoot;
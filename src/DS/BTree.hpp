@@ -0,0 +1,413 @@
+/**
+ * @file BTree.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief B+ Tree (ordered map, leaf linked, cache-line sized nodes)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DS_BTREE_SSE2 1
+#endif
+
+namespace DS {
+
+/// @brief @b default_fanout => keys of one node fill 4 cache lines (256 bytes)
+template <typename K>
+inline constexpr int BTreeDefaultFanout = std::max<int>(8, 256 / static_cast<int>(sizeof(K)));
+
+template <typename K, typename V, int B = BTreeDefaultFanout<K>>
+requires std::totally_ordered<K> && (B >= 4)
+class BTree {
+    static constexpr int CacheLine = 64;
+
+    /// @brief @b node_layout
+    /// inner => `count` keys, `count + 1` children
+    /// leaf  => `count` keys, `count` values, linked to the next leaf
+    struct alignas(CacheLine) Node {
+        int  count   = 0;
+        bool is_leaf = false;
+        K    keys[B] {};
+    };
+    struct Inner : Node {
+        Node* children[B + 1] {};
+
+        Inner() { this->is_leaf = false; }
+    };
+    struct Leaf : Node {
+        V     values[B] {};
+        Leaf* next = nullptr;
+
+        Leaf() { this->is_leaf = true; }
+    };
+
+    /// @brief @b result_of_a_split => (separator, new right sibling)
+    struct Split {
+        K     separator {};
+        Node* right = nullptr;
+    };
+
+    Node* TheRoot = nullptr;
+    Leaf* Head    = nullptr; // left-most leaf
+    int   size    = 0;
+    int   height  = 0;
+
+private:
+    /// @brief @b intra_node_search
+    /// number of keys in `keys[0, count)` which are `< key`
+    static int rank_less(const K* keys, int count, const K& key) {
+        if constexpr (std::is_arithmetic_v<K>) {
+            int res = 0;
+            int idx = 0;
+#ifdef DS_BTREE_SSE2
+            if constexpr (std::is_integral_v<K> && sizeof(K) == 4) {
+                const __m128i target = _mm_set1_epi32(static_cast<int>(key));
+                for (; idx + 4 <= count; idx += 4) {
+                    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + idx));
+                    __m128i less  = std::is_signed_v<K>
+                         ? _mm_cmplt_epi32(block, target)
+                         : _mm_cmplt_epi32(
+                             _mm_xor_si128(block, _mm_set1_epi32(INT32_MIN)),
+                             _mm_xor_si128(target, _mm_set1_epi32(INT32_MIN))
+                         );
+                    res += std::popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(less))));
+                }
+            }
+#endif
+            // branch-free tail (and the whole node for the other arithmetic types)
+            for (; idx < count; ++idx) {
+                res += keys[idx] < key;
+            }
+            return res;
+        } else {
+            return static_cast<int>(std::lower_bound(keys, keys + count, key) - keys);
+        }
+    }
+    /// number of keys in `keys[0, count)` which are `<= key`
+    static int rank_less_equal(const K* keys, int count, const K& key) {
+        int res = rank_less(keys, count, key);
+        while (res < count && !(key < keys[res])) {
+            ++res;
+        }
+        return res;
+    }
+
+    void delete_tree(Node* toDelete) {
+        if (!toDelete) {
+            return;
+        }
+        if (toDelete->is_leaf) {
+            delete static_cast<Leaf*>(toDelete);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(toDelete);
+        for (int idx = 0; idx <= inner->count; ++idx) {
+            delete_tree(inner->children[idx]);
+        }
+        delete inner;
+    }
+
+    /// @brief @b insert_helpers
+    bool insert_into_leaf(Leaf* leaf, const K& key, const V& value, Split& split) {
+        int pos = rank_less(leaf->keys, leaf->count, key);
+        if (pos < leaf->count && leaf->keys[pos] == key) {
+            leaf->values[pos] = value; // already exists, overwrite
+            return false;
+        }
+        if (leaf->count < B) {
+            std::move_backward(leaf->keys + pos, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            std::move_backward(leaf->values + pos, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+            leaf->keys[pos]   = key;
+            leaf->values[pos] = value;
+            ++leaf->count;
+            return true;
+        }
+        // full => split into [0, mid) and [mid, B]
+        std::array<K, B + 1> keys;
+        std::array<V, B + 1> values;
+        std::move(leaf->keys, leaf->keys + pos, keys.begin());
+        std::move(leaf->values, leaf->values + pos, values.begin());
+        keys[pos]   = key;
+        values[pos] = value;
+        std::move(leaf->keys + pos, leaf->keys + B, keys.begin() + pos + 1);
+        std::move(leaf->values + pos, leaf->values + B, values.begin() + pos + 1);
+
+        constexpr int mid   = (B + 1) / 2;
+        Leaf*         right = new Leaf();
+        std::move(keys.begin(), keys.begin() + mid, leaf->keys);
+        std::move(values.begin(), values.begin() + mid, leaf->values);
+        std::move(keys.begin() + mid, keys.end(), right->keys);
+        std::move(values.begin() + mid, values.end(), right->values);
+        leaf->count  = mid;
+        right->count = B + 1 - mid;
+        right->next  = leaf->next;
+        leaf->next   = right;
+
+        split.separator = right->keys[0];
+        split.right     = right;
+        return true;
+    }
+    void insert_into_inner(Inner* inner, int pos, const Split& child_split, Split& split) {
+        if (inner->count < B) {
+            std::move_backward(inner->keys + pos, inner->keys + inner->count, inner->keys + inner->count + 1);
+            std::move_backward(inner->children + pos + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+            inner->keys[pos]         = child_split.separator;
+            inner->children[pos + 1] = child_split.right;
+            ++inner->count;
+            return;
+        }
+        // full => split, the middle key goes up
+        std::array<K, B + 1>     keys;
+        std::array<Node*, B + 2> children;
+        std::move(inner->keys, inner->keys + pos, keys.begin());
+        keys[pos] = child_split.separator;
+        std::move(inner->keys + pos, inner->keys + B, keys.begin() + pos + 1);
+        std::copy(inner->children, inner->children + pos + 1, children.begin());
+        children[pos + 1] = child_split.right;
+        std::copy(inner->children + pos + 1, inner->children + B + 1, children.begin() + pos + 2);
+
+        constexpr int mid   = (B + 1) / 2;
+        Inner*        right = new Inner();
+        std::move(keys.begin(), keys.begin() + mid, inner->keys);
+        std::copy(children.begin(), children.begin() + mid + 1, inner->children);
+        std::move(keys.begin() + mid + 1, keys.end(), right->keys);
+        std::copy(children.begin() + mid + 1, children.end(), right->children);
+        inner->count = mid;
+        right->count = B - mid;
+
+        split.separator = std::move(keys[mid]);
+        split.right     = right;
+    }
+    bool insert_rec(Node* node, const K& key, const V& value, Split& split) {
+        if (node->is_leaf) {
+            return insert_into_leaf(static_cast<Leaf*>(node), key, value, split);
+        }
+        Inner* inner       = static_cast<Inner*>(node);
+        int    pos         = rank_less_equal(inner->keys, inner->count, key);
+        Split  child_split = {};
+        bool   if_inserted = insert_rec(inner->children[pos], key, value, child_split);
+        if (child_split.right) {
+            insert_into_inner(inner, pos, child_split, split);
+        }
+        return if_inserted;
+    }
+
+    Leaf* find_leaf(const K& key) const {
+        Node* node = TheRoot;
+        if (!node) {
+            return nullptr;
+        }
+        while (!node->is_leaf) {
+            const Inner* inner = static_cast<const Inner*>(node);
+            node               = inner->children[rank_less_equal(inner->keys, inner->count, key)];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    /// @brief @b bulk_load_helper => split `total` items into nearly equal groups of at most `cap`
+    static std::vector<int> even_groups(int total, int cap) {
+        int              num_of_group = (total + cap - 1) / cap;
+        std::vector<int> res(num_of_group, total / num_of_group);
+        for (int idx = 0; idx < total % num_of_group; ++idx) {
+            ++res[idx];
+        }
+        return res;
+    }
+
+public:
+    /// @brief @b constructor_and_destructor
+    BTree() = default;
+    ~BTree() {
+        delete_tree(TheRoot);
+    }
+    BTree(const BTree&)            = delete;
+    BTree& operator=(const BTree&) = delete;
+    BTree(BTree&& moved) noexcept
+        : TheRoot(moved.TheRoot)
+        , Head(moved.Head)
+        , size(moved.size)
+        , height(moved.height) {
+        moved.TheRoot = nullptr;
+        moved.Head    = nullptr;
+        moved.size    = 0;
+        moved.height  = 0;
+    }
+    BTree& operator=(BTree&& moved) noexcept {
+        if (&moved == this) {
+            return *this;
+        }
+        delete_tree(TheRoot);
+        TheRoot       = moved.TheRoot;
+        Head          = moved.Head;
+        size          = moved.size;
+        height        = moved.height;
+        moved.TheRoot = nullptr;
+        moved.Head    = nullptr;
+        moved.size    = 0;
+        moved.height  = 0;
+        return *this;
+    }
+
+    /// @brief @b bulk_load => `sorted` must be strictly increasing by key, O(n)
+    static BTree from_sorted(const std::vector<std::pair<K, V>>& sorted) {
+        BTree res;
+        if (sorted.empty()) {
+            return res;
+        }
+        for (std::size_t idx = 1; idx < sorted.size(); ++idx) {
+            if (!(sorted[idx - 1].first < sorted[idx].first)) {
+                throw std::logic_error("Input of `from_sorted` is NOT strictly increasing!");
+            }
+        }
+        // 1. pack leaves, record (node, min_key) of each
+        std::vector<std::pair<Node*, K>> level;
+        Leaf*                            prev = nullptr;
+        int                              beg  = 0;
+        for (int leaf_size : even_groups(static_cast<int>(sorted.size()), B)) {
+            Leaf* leaf = new Leaf();
+            for (int idx = 0; idx < leaf_size; ++idx) {
+                leaf->keys[idx]   = sorted[beg + idx].first;
+                leaf->values[idx] = sorted[beg + idx].second;
+            }
+            leaf->count = leaf_size;
+            if (prev) {
+                prev->next = leaf;
+            } else {
+                res.Head = leaf;
+            }
+            level.emplace_back(leaf, sorted[beg].first);
+            prev = leaf;
+            beg += leaf_size;
+        }
+        res.height = 1;
+        // 2. build inner levels bottom-up
+        while (level.size() > 1) {
+            std::vector<std::pair<Node*, K>> upper;
+            int                              child_beg = 0;
+            for (int num_of_child : even_groups(static_cast<int>(level.size()), B + 1)) {
+                Inner* inner = new Inner();
+                for (int idx = 0; idx < num_of_child; ++idx) {
+                    inner->children[idx] = level[child_beg + idx].first;
+                    if (idx) {
+                        inner->keys[idx - 1] = level[child_beg + idx].second;
+                    }
+                }
+                inner->count = num_of_child - 1;
+                upper.emplace_back(inner, level[child_beg].second);
+                child_beg += num_of_child;
+            }
+            level = std::move(upper);
+            ++res.height;
+        }
+        res.TheRoot = level.front().first;
+        res.size    = static_cast<int>(sorted.size());
+        return res;
+    }
+
+    /// @brief @b size_related
+    int  get_size() const { return size; }
+    int  get_height() const { return height; }
+    bool empty() const { return size == 0; }
+
+    /// @brief @b insert_or_assign
+    void insert(const K& key, const V& value) {
+        if (!TheRoot) {
+            Leaf* leaf      = new Leaf();
+            leaf->keys[0]   = key;
+            leaf->values[0] = value;
+            leaf->count     = 1;
+            TheRoot         = leaf;
+            Head            = leaf;
+            size            = 1;
+            height          = 1;
+            return;
+        }
+        Split split = {};
+        if (insert_rec(TheRoot, key, value, split)) {
+            ++size;
+        }
+        if (split.right) {
+            // root has been split => grow a new root
+            Inner* root       = new Inner();
+            root->keys[0]     = std::move(split.separator);
+            root->children[0] = TheRoot;
+            root->children[1] = split.right;
+            root->count       = 1;
+            TheRoot           = root;
+            ++height;
+        }
+    }
+
+    /// @brief @b point_lookup => nullptr if not found
+    V* find(const K& key) {
+        Leaf* leaf = find_leaf(key);
+        if (!leaf) {
+            return nullptr;
+        }
+        int pos = rank_less(leaf->keys, leaf->count, key);
+        if (pos < leaf->count && leaf->keys[pos] == key) {
+            return &leaf->values[pos];
+        }
+        return nullptr;
+    }
+    const V* find(const K& key) const {
+        return const_cast<BTree*>(this)->find(key);
+    }
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    /// @brief @b range_scan => func(key, value) for every key in [lo, hi], ascending
+    template <typename Func>
+    void range_scan(const K& lo, const K& hi, Func&& func) const {
+        const Leaf* leaf = find_leaf(lo);
+        if (!leaf) {
+            return;
+        }
+        int pos = rank_less(leaf->keys, leaf->count, lo);
+        while (leaf) {
+            for (; pos < leaf->count; ++pos) {
+                if (hi < leaf->keys[pos]) {
+                    return;
+                }
+                func(leaf->keys[pos], leaf->values[pos]);
+            }
+            leaf = leaf->next;
+            pos  = 0;
+        }
+    }
+    template <typename Func>
+    void for_each(Func&& func) const {
+        for (const Leaf* leaf = Head; leaf; leaf = leaf->next) {
+            for (int pos = 0; pos < leaf->count; ++pos) {
+                func(leaf->keys[pos], leaf->values[pos]);
+            }
+        }
+    }
+
+    void print_tree() const {
+        for_each([](const K& key, const V& value) {
+            std::cout << key << ":" << value << " ";
+        });
+        std::cout << std::endl;
+    }
+};
+
+} // namespace DS
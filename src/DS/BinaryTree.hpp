@@ -11,13 +11,23 @@
 
 #pragma once
 #include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <iterator>
 #include <queue>
+#include <span>
 #include <stack>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace DS {
 
@@ -40,7 +50,8 @@ private:
     int   size    = 0;
 
     /// @brief @b Recursive_Order_Template_Functions
-    void PreOrderOpt_Rec(Node* node, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void PreOrderOpt_Rec(Node* node, Func& func) {
         if (!node) {
             return;
         }
@@ -48,7 +59,8 @@ private:
         PreOrderOpt_Rec(node->left, func);
         PreOrderOpt_Rec(node->right, func);
     }
-    void InOrderOpt_Rec(Node* node, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void InOrderOpt_Rec(Node* node, Func& func) {
         if (!node) {
             return;
         }
@@ -56,7 +68,8 @@ private:
         func(node);
         InOrderOpt_Rec(node->right, func);
     }
-    void PostOrderOpt_Rec(Node* node, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void PostOrderOpt_Rec(Node* node, Func& func) {
         if (!node) {
             return;
         }
@@ -65,8 +78,11 @@ private:
         func(node);
     }
 
+public:
     /// @brief @b Iterative_Order_Template_Functions
-    void LevelOrderOpt(Node* input, std::function<void(Node*)>& func) {
+    /// func(Node*), any callable => inlined, no `std::function` indirection
+    template <typename Func>
+    void LevelOrderOpt(Node* input, Func&& func) {
         Node* node = input; // copy the ptr
                             // Avoid change the direction of `input` ptr
 
@@ -88,7 +104,8 @@ private:
             opt_queue.pop();
         }
     }
-    void PreOrderOpt(Node* input, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void PreOrderOpt(Node* input, Func&& func) {
         Node* node = input; // copy the ptr
                             // Avoid change the direction of `input` ptr
 
@@ -96,7 +113,7 @@ private:
             return;
         }
 
-        std::stack<Node*> opt_stack;
+        std::stack<Node*, std::vector<Node*>> opt_stack;
         // condition `node` => specifically designed for `emplace the first node`
         // if only `!opt_stack.empty()`, never try to get into the loop
         while (node || !opt_stack.empty()) {
@@ -113,14 +130,15 @@ private:
             node = node->right;
         }
     }
-    void InOrderOpt(Node* input, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void InOrderOpt(Node* input, Func&& func) {
         Node* node = input; // copy the ptr
 
         if (!node) { // uninitialized
             return;
         }
 
-        std::stack<Node*> opt_stack;
+        std::stack<Node*, std::vector<Node*>> opt_stack;
         // condition `node` => specifically designed for `emplace the first node`
         // if only `!opt_stack.empty()`, never try to get into the loop
         while (node || !opt_stack.empty()) {
@@ -137,7 +155,8 @@ private:
             node = node->right;
         }
     }
-    void PostOrderOpt(Node* input, std::function<void(Node*)>& func) {
+    template <typename Func>
+    void PostOrderOpt(Node* input, Func&& func) {
         Node* node = input; // copy the ptr
                             // Avoid change the direction of `input` ptr
 
@@ -146,7 +165,7 @@ private:
         }
 
         // <node, flag> (flag => 0: finished left, 1: finished left & right)
-        std::stack<std::pair<Node*, int>> opt_stack;
+        std::stack<std::pair<Node*, int>, std::vector<std::pair<Node*, int>>> opt_stack;
         // condition `node` => specifically designed for `emplace the first node`
         // if only `!opt_stack.empty()`, never try to get into the loop
         while (node || !opt_stack.empty()) {
@@ -173,23 +192,275 @@ private:
         }
     }
 
-    std::function<void(Node*)> DeleteNode = [this](Node* toDelete) {
-        delete toDelete;
-        --size;
+    /// @brief @b Morris_Traversal (threaded, O(1) extra space)
+    /// right links of some predecessors are borrowed during the walk,
+    /// so `func` should only touch `elem`, never the links
+    template <typename Func>
+    void MorrisInOrderOpt(Node* input, Func&& func) {
+        Node* node = input;
+        while (node) {
+            if (!node->left) {
+                func(node);
+                node = node->right;
+                continue;
+            }
+            Node* pred = node->left;
+            while (pred->right && pred->right != node) {
+                pred = pred->right;
+            }
+            if (!pred->right) { // first visit => thread, go left
+                pred->right = node;
+                node        = node->left;
+            } else { // second visit => un-thread, opt, go right
+                pred->right = nullptr;
+                func(node);
+                node = node->right;
+            }
+        }
+    }
+    template <typename Func>
+    void MorrisPreOrderOpt(Node* input, Func&& func) {
+        Node* node = input;
+        while (node) {
+            if (!node->left) {
+                func(node);
+                node = node->right;
+                continue;
+            }
+            Node* pred = node->left;
+            while (pred->right && pred->right != node) {
+                pred = pred->right;
+            }
+            if (!pred->right) { // first visit => opt, thread, go left
+                func(node);
+                pred->right = node;
+                node        = node->left;
+            } else { // second visit => un-thread, go right
+                pred->right = nullptr;
+                node        = node->right;
+            }
+        }
+    }
+
+    /// @brief @b Traverse_Engine (from the root)
+    template <typename Func>
+    void PreOrderOpt(Func&& func) { PreOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void InOrderOpt(Func&& func) { InOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void PostOrderOpt(Func&& func) { PostOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void LevelOrderOpt(Func&& func) { LevelOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void MorrisInOrderOpt(Func&& func) { MorrisInOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void MorrisPreOrderOpt(Func&& func) { MorrisPreOrderOpt(TheRoot, std::forward<Func>(func)); }
+    template <typename Func>
+    void PreOrderOpt_Rec(Func&& func) { PreOrderOpt_Rec(TheRoot, func); }
+    template <typename Func>
+    void InOrderOpt_Rec(Func&& func) { InOrderOpt_Rec(TheRoot, func); }
+    template <typename Func>
+    void PostOrderOpt_Rec(Func&& func) { PostOrderOpt_Rec(TheRoot, func); }
+
+private:
+    /// @brief @b built_in_visitors
+    struct DeleteNode {
+        BinaryTree* tree;
+        void        operator()(Node* toDelete) const {
+            delete toDelete;
+            --tree->size;
+        }
     };
-    std::function<void(Node*)> PrintNode = [](Node* node) {
-        std::cout << node->elem << " ";
+    struct PrintNode {
+        void operator()(Node* node) const {
+            std::cout << node->elem << " ";
+        }
     };
-    std::function<void(Node*)> PrintlnNode = [](Node* node) {
-        std::cout << node->elem << std::endl;
+    struct PrintlnNode {
+        void operator()(Node* node) const {
+            std::cout << node->elem << std::endl;
+        }
     };
-    std::function<void(Node*)> InvertChildSubTree = [](Node* node) {
-        Node* _left_  = node->left;
-        Node* _right_ = node->right;
-        node->left    = _right_;
-        node->right   = _left_;
+    struct InvertChildSubTree {
+        void operator()(Node* node) const {
+            std::swap(node->left, node->right);
+        }
     };
 
+    /// @brief @b structural_copy (pre-order, iterative, no serialization)
+    static Node* CloneSubTree(Node* input) {
+        Node* res = nullptr;
+        // (source node, link to fill)
+        std::vector<std::pair<Node*, Node**>> opt_stack;
+        if (input) {
+            opt_stack.emplace_back(input, &res);
+        }
+        while (!opt_stack.empty()) {
+            auto [node, link] = opt_stack.back();
+            opt_stack.pop_back();
+            *link = new Node(node->elem);
+            if (node->right) {
+                opt_stack.emplace_back(node->right, &(*link)->right);
+            }
+            if (node->left) {
+                opt_stack.emplace_back(node->left, &(*link)->left);
+            }
+        }
+        return res;
+    }
+    /// @brief @b structural_equality (same shape & same elems)
+    static bool IfSameSubTree(Node* lhs, Node* rhs) {
+        std::vector<std::pair<Node*, Node*>> opt_stack;
+        opt_stack.emplace_back(lhs, rhs);
+        while (!opt_stack.empty()) {
+            auto [l_node, r_node] = opt_stack.back();
+            opt_stack.pop_back();
+            if (!l_node || !r_node) {
+                if (l_node != r_node) {
+                    return false;
+                }
+                continue;
+            }
+            if (!(l_node->elem == r_node->elem)) {
+                return false;
+            }
+            opt_stack.emplace_back(l_node->right, r_node->right);
+            opt_stack.emplace_back(l_node->left, r_node->left);
+        }
+        return true;
+    }
+
+    /// @brief @b bottom_up_fold
+    /// res(node) = combine(node, res(left), res(right)), res(nullptr) = empty
+    /// children are folded before `combine` of their parent runs,
+    /// and `combine` may only touch the given node and its direct links
+    template <typename R, typename Combine>
+    static R SequentialFold(Node* input, const R& empty, Combine& combine) {
+        if (!input) {
+            return empty;
+        }
+        // <node, flag> (flag => 0: children not pushed yet, 1: pushed)
+        std::vector<std::pair<Node*, int>> opt_stack { { input, 0 } };
+        std::vector<R>                     results;
+        while (!opt_stack.empty()) {
+            auto& [node, flag] = opt_stack.back();
+            if (flag == 0) {
+                flag       = 1;
+                Node* curr = node; // `node` dangles after the pushes
+                if (curr->right) {
+                    opt_stack.emplace_back(curr->right, 0);
+                }
+                if (curr->left) {
+                    opt_stack.emplace_back(curr->left, 0);
+                }
+                continue;
+            }
+            Node* curr = node;
+            opt_stack.pop_back();
+            R right = empty;
+            R left  = empty;
+            if (curr->right) {
+                right = std::move(results.back());
+                results.pop_back();
+            }
+            if (curr->left) {
+                left = std::move(results.back());
+                results.pop_back();
+            }
+            results.push_back(combine(curr, std::move(left), std::move(right)));
+        }
+        return std::move(results.back());
+    }
+    /// @brief fork the left sub tree as a task until `cutoff` levels deep
+    template <typename R, typename Combine>
+    static R ParallelFold(Node* node, const R& empty, Combine& combine, int cutoff) {
+        if (!node) {
+            return empty;
+        }
+        if (cutoff <= 0) {
+            return SequentialFold(node, empty, combine);
+        }
+        auto left_task = std::async(std::launch::async, [&] {
+            return ParallelFold(node->left, empty, combine, cutoff - 1);
+        });
+        R right = ParallelFold(node->right, empty, combine, cutoff - 1);
+        R left  = left_task.get();
+        return combine(node, std::move(left), std::move(right));
+    }
+    /// @brief delete the whole sub tree, return the number of deleted nodes
+    static int DeleteSubTree(Node* input) {
+        int                count = 0;
+        std::vector<Node*> opt_stack;
+        if (input) {
+            opt_stack.push_back(input);
+        }
+        while (!opt_stack.empty()) {
+            Node* node = opt_stack.back();
+            opt_stack.pop_back();
+            if (node->left) {
+                opt_stack.push_back(node->left);
+            }
+            if (node->right) {
+                opt_stack.push_back(node->right);
+            }
+            delete node;
+            ++count;
+        }
+        return count;
+    }
+
+    /// @brief @b wire_format_helpers
+    static void WriteVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+    static std::uint64_t ReadVarint(std::span<const std::uint8_t> in, std::size_t& pos) {
+        std::uint64_t res   = 0;
+        int           shift = 0;
+        while (true) {
+            if (pos >= in.size() || shift > 63) {
+                throw std::runtime_error("Broken BinaryTree buffer (varint). ");
+            }
+            std::uint8_t byte = in[pos++];
+            res |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return res;
+            }
+            shift += 7;
+        }
+    }
+    static void WriteElem(std::vector<std::uint8_t>& out, const T& elem) {
+        if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            // zigzag => small negative numbers stay short
+            auto value = static_cast<std::int64_t>(elem);
+            WriteVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        } else if constexpr (std::is_integral_v<T>) {
+            WriteVarint(out, static_cast<std::uint64_t>(elem));
+        } else {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&elem);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+    }
+    static T ReadElem(std::span<const std::uint8_t> in, std::size_t& pos) {
+        if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            std::uint64_t value = ReadVarint(in, pos);
+            return static_cast<T>(static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1));
+        } else if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(ReadVarint(in, pos));
+        } else {
+            if (pos + sizeof(T) > in.size()) {
+                throw std::runtime_error("Broken BinaryTree buffer (value). ");
+            }
+            T res;
+            std::memcpy(&res, in.data() + pos, sizeof(T));
+            pos += sizeof(T);
+            return res;
+        }
+    }
+
     /// @brief @b default_constructor
     BinaryTree() = default;
 
@@ -287,9 +558,112 @@ public:
         return std::make_pair(root, num_of_node);
     }
 
+    /// @brief @b binary_wire_format
+    /// [varint: num_of_node]
+    /// [structure bitmap: 2 bits / node in pre-order => has_left, has_right]
+    /// [values in pre-order: (zigzag) varint for integers, raw bytes otherwise]
+    /// appends to `out`, which could be reused (no per-node allocation)
+    void SerializeToBuffer(std::vector<std::uint8_t>& out) const
+    requires std::is_trivially_copyable_v<T>
+    {
+        const std::size_t num_of_node = static_cast<std::size_t>(size);
+        WriteVarint(out, num_of_node);
+        if (!TheRoot) {
+            return;
+        }
+        const std::size_t bitmap_pos = out.size();
+        out.resize(out.size() + (2 * num_of_node + 7) / 8, 0);
+
+        std::size_t        bit = 0;
+        std::vector<Node*> opt_stack { TheRoot };
+        while (!opt_stack.empty()) {
+            Node* node = opt_stack.back();
+            opt_stack.pop_back();
+            if (bit >= 2 * num_of_node) {
+                throw std::logic_error("BinaryTree size is out of sync with its nodes!");
+            }
+            if (node->left) {
+                out[bitmap_pos + bit / 8] |= static_cast<std::uint8_t>(1u << (bit % 8));
+            }
+            if (node->right) {
+                out[bitmap_pos + (bit + 1) / 8] |= static_cast<std::uint8_t>(1u << ((bit + 1) % 8));
+            }
+            bit += 2;
+            WriteElem(out, node->elem);
+            if (node->right) {
+                opt_stack.push_back(node->right);
+            }
+            if (node->left) {
+                opt_stack.push_back(node->left);
+            }
+        }
+    }
+    void SerializeToStream(std::ostream& out) const
+    requires std::is_trivially_copyable_v<T>
+    {
+        std::vector<std::uint8_t> buffer;
+        SerializeToBuffer(buffer);
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+    static BinaryTree DeserializeFromBuffer(std::span<const std::uint8_t> in)
+    requires std::is_trivially_copyable_v<T>
+    {
+        BinaryTree  res;
+        std::size_t pos         = 0;
+        std::size_t num_of_node = ReadVarint(in, pos);
+        if (!num_of_node && pos == in.size()) {
+            return res;
+        }
+        // untrusted count => at least 2 bits per node must follow, checked
+        // before `2 * num_of_node` could wrap
+        if (num_of_node > (in.size() - pos) * 4) {
+            throw std::runtime_error("Broken BinaryTree buffer (node count). ");
+        }
+        const std::size_t bitmap_pos = pos;
+        pos += (2 * num_of_node + 7) / 8;
+        if (pos > in.size()) {
+            throw std::runtime_error("Broken BinaryTree buffer (bitmap). ");
+        }
+        // links waiting for a node, in pre-order
+        std::vector<Node**> opt_stack { &res.TheRoot };
+        for (std::size_t bit = 0; bit < 2 * num_of_node; bit += 2) {
+            if (opt_stack.empty()) {
+                throw std::runtime_error("Broken BinaryTree buffer (structure). ");
+            }
+            Node** link = opt_stack.back();
+            opt_stack.pop_back();
+            *link = new Node(ReadElem(in, pos));
+            ++res.size;
+            bool if_has_left  = in[bitmap_pos + bit / 8] & (1u << (bit % 8));
+            bool if_has_right = in[bitmap_pos + (bit + 1) / 8] & (1u << ((bit + 1) % 8));
+            if (if_has_right) {
+                opt_stack.push_back(&(*link)->right);
+            }
+            if (if_has_left) {
+                opt_stack.push_back(&(*link)->left);
+            }
+        }
+        if (!opt_stack.empty()) {
+            throw std::runtime_error("Broken BinaryTree buffer (structure). ");
+        }
+        if (pos != in.size()) {
+            throw std::runtime_error("Broken BinaryTree buffer (trailing bytes). ");
+        }
+        return res;
+    }
+    static BinaryTree DeserializeFromStream(std::istream& in)
+    requires std::is_trivially_copyable_v<T>
+    {
+        std::vector<std::uint8_t> buffer(
+            (std::istreambuf_iterator<char>(in)),
+            std::istreambuf_iterator<char>()
+        );
+        return DeserializeFromBuffer(buffer);
+    }
+
     /// @brief @b destructor
     ~BinaryTree() {
-        PostOrderOpt(TheRoot, DeleteNode);
+        PostOrderOpt(TheRoot, DeleteNode { this });
         TheRoot = nullptr;
     }
 
@@ -301,6 +675,10 @@ public:
         moved.TheRoot = nullptr;
     }
     BinaryTree& operator=(BinaryTree&& moved) noexcept {
+        if (&moved == this) {
+            return *this;
+        }
+        PostOrderOpt(TheRoot, DeleteNode { this });
         size          = moved.size;
         TheRoot       = moved.TheRoot;
         moved.size    = 0;
@@ -309,58 +687,48 @@ public:
     }
 
     /// @brief @b copy_constructor_and_assigner
-    BinaryTree(BinaryTree& copied)
-    requires std::is_same_v<T, int>
-    {
-        // Deserialize and then Serialize
-        std::vector<std::string> DeserializedData
-            = copied.SerializeToVec();
-        std::pair<Node*, int> root_num_pair
-            = copied.DeserializeFromVec(DeserializedData);
-        TheRoot = root_num_pair.first;
-        size    = root_num_pair.second;
-    }
-    BinaryTree& operator=(BinaryTree& copied)
-    requires std::is_same_v<T, int>
+    BinaryTree(const BinaryTree& copied)
+    requires std::copyable<T>
+        : TheRoot(CloneSubTree(copied.TheRoot))
+        , size(copied.size) {
+    }
+    BinaryTree& operator=(const BinaryTree& copied)
+    requires std::copyable<T>
     {
         if (&copied == this) {
             return *this;
         }
-        // Deserialize and then Serialize
-        std::vector<std::string> DeserializedData
-            = copied.SerializeToVec();
-        std::pair<Node*, int> root_num_pair
-            = copied.DeserializeFromVec(DeserializedData);
-        TheRoot = root_num_pair.first;
-        size    = root_num_pair.second;
+        PostOrderOpt(TheRoot, DeleteNode { this });
+        TheRoot = CloneSubTree(copied.TheRoot);
+        size    = copied.size;
 
         return *this;
     }
 
     /// @brief @b Traverse
     void PreOrderTraverse() {
-        PreOrderOpt(TheRoot, PrintNode);
+        PreOrderOpt(TheRoot, PrintNode {});
     }
     void InOrderTraverse() {
-        InOrderOpt(TheRoot, PrintNode);
+        InOrderOpt(TheRoot, PrintNode {});
     }
     void PostOrderTraverse() {
-        PostOrderOpt(TheRoot, PrintNode);
+        PostOrderOpt(TheRoot, PrintNode {});
     }
     void LevelOrderTraverse() {
-        LevelOrderOpt(TheRoot, PrintNode);
+        LevelOrderOpt(TheRoot, PrintNode {});
     }
     void PreOrderTraverse(Node* theRoot) {
-        PreOrderOpt(theRoot, PrintNode);
+        PreOrderOpt(theRoot, PrintNode {});
     }
     void InOrderTraverse(Node* theRoot) {
-        InOrderOpt(theRoot, PrintNode);
+        InOrderOpt(theRoot, PrintNode {});
     }
     void PostOrderTraverse(Node* theRoot) {
-        PostOrderOpt(theRoot, PrintNode);
+        PostOrderOpt(theRoot, PrintNode {});
     }
     void LevelOrderTraverse(Node* theRoot) {
-        LevelOrderOpt(theRoot, PrintNode);
+        LevelOrderOpt(theRoot, PrintNode {});
     }
 
     /// @brief @b size_related
@@ -533,7 +901,7 @@ public:
         return res;
     }
     void InvertTree() {
-        LevelOrderOpt(TheRoot, InvertChildSubTree);
+        LevelOrderOpt(TheRoot, InvertChildSubTree {});
     }
 
     /// @brief @b Processing
@@ -572,10 +940,10 @@ public:
             throw std::runtime_error("Unknown delete position type. ");
         }
         if (LR == 0) {
-            PostOrderOpt(node->left, DeleteNode);
+            PostOrderOpt(node->left, DeleteNode { this });
             node->left = nullptr; // must set to nullptr
         } else {
-            PostOrderOpt(node->right, DeleteNode);
+            PostOrderOpt(node->right, DeleteNode { this });
             node->right = nullptr; // must set to nullptr
         }
     }
@@ -602,26 +970,26 @@ public:
         return CreateBiTree_LevelOrder(data);
     }
 
-    /// @brief @b compare_if_same(int_BiTree_supported_only)
-    static bool IfSame(BinaryTree<T>& lhs, BinaryTree<T>& rhs)
-    requires std::is_same_v<T, int>
+    /// @brief @b compare_if_same (structural, no serialization)
+    static bool IfSame(const BinaryTree<T>& lhs, const BinaryTree<T>& rhs)
+    requires std::equality_comparable<T>
     {
-        return lhs.SerializeToVec() == rhs.SerializeToVec();
+        return lhs.size == rhs.size && IfSameSubTree(lhs.TheRoot, rhs.TheRoot);
     }
-    friend bool operator==(BinaryTree<T>& lhs, BinaryTree<T>& rhs)
-    requires std::is_same_v<T, int>
+    friend bool operator==(const BinaryTree<T>& lhs, const BinaryTree<T>& rhs)
+    requires std::equality_comparable<T>
     {
-        return lhs.SerializeToVec() == rhs.SerializeToVec();
+        return IfSame(lhs, rhs);
     }
-    static bool IfNotSame(BinaryTree<T>& lhs, BinaryTree<T>& rhs)
-    requires std::is_same_v<T, int>
+    static bool IfNotSame(const BinaryTree<T>& lhs, const BinaryTree<T>& rhs)
+    requires std::equality_comparable<T>
     {
-        return !(lhs.SerializeToVec() == rhs.SerializeToVec());
+        return !IfSame(lhs, rhs);
     }
-    friend bool operator!=(BinaryTree<T>& lhs, BinaryTree<T>& rhs)
-    requires std::is_same_v<T, int>
+    friend bool operator!=(const BinaryTree<T>& lhs, const BinaryTree<T>& rhs)
+    requires std::equality_comparable<T>
     {
-        return !(lhs.SerializeToVec() == rhs.SerializeToVec());
+        return !IfSame(lhs, rhs);
     }
 
     /// @brief @b check_if_is_full_BiTree
@@ -657,6 +1025,108 @@ public:
         return true;
     }
 
+    /// @brief @b parallel_fork_join
+    /// sub trees above `cutoff` levels are folded by separate tasks
+    /// (about 2^cutoff tasks), everything below runs sequentially
+    static int ParallelCutoff() {
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<int>(std::bit_width(threads)) + 1;
+    }
+    /// @brief combine(node, left_res, right_res) -> R, must be thread safe
+    template <typename R, typename Combine>
+    R ParallelFold(const R& empty, Combine&& combine, int cutoff = ParallelCutoff()) {
+        return ParallelFold(TheRoot, empty, combine, cutoff);
+    }
+    /// @brief reduce all elems with a monoid (same interface as BST's),
+    /// combined in in-order => `combine` needs no commutativity
+    template <typename Monoid>
+    typename Monoid::ValueType ParallelReduce(int cutoff = ParallelCutoff()) {
+        using ValueType = typename Monoid::ValueType;
+        auto combine    = [](Node* node, ValueType left, ValueType right) {
+            return Monoid::combine(Monoid::combine(left, Monoid::lift(node->elem)), right);
+        };
+        return ParallelFold(TheRoot, Monoid::identity(), combine, cutoff);
+    }
+    int BiTreeSize_Parallel(int cutoff = ParallelCutoff()) {
+        auto combine = [](Node*, int left, int right) { return left + right + 1; };
+        return ParallelFold(TheRoot, 0, combine, cutoff);
+    }
+    int BiTreeDepth_Parallel(int cutoff = ParallelCutoff()) {
+        auto combine = [](Node*, int left, int right) { return std::max(left, right) + 1; };
+        return ParallelFold(TheRoot, 0, combine, cutoff);
+    }
+    int BiTreeBreadth_Parallel(int cutoff = ParallelCutoff()) {
+        // res[i] => num of nodes on the i-th level of the sub tree, deepest
+        // first => the root level is a `push_back`, a merge is O(shorter side)
+        auto combine = [](Node*, std::vector<int> left, std::vector<int> right) {
+            if (left.size() < right.size()) {
+                std::swap(left, right);
+            }
+            const std::size_t offset = left.size() - right.size(); // align the roots
+            for (std::size_t level = 0; level < right.size(); ++level) {
+                left[offset + level] += right[level];
+            }
+            left.push_back(1);
+            return left;
+        };
+        std::vector<int> width_of_level = ParallelFold(TheRoot, std::vector<int> {}, combine, cutoff);
+        return width_of_level.empty()
+            ? 0
+            : *std::max_element(width_of_level.begin(), width_of_level.end());
+    }
+    bool IfCompleteBiTree_Parallel(int cutoff = ParallelCutoff()) {
+        struct Shape {
+            int  depth       = 0;
+            bool if_perfect  = true;
+            bool if_complete = true;
+        };
+        auto combine = [](Node*, Shape left, Shape right) {
+            Shape res;
+            res.depth      = std::max(left.depth, right.depth) + 1;
+            res.if_perfect = left.if_perfect && right.if_perfect && left.depth == right.depth;
+            // last level is filled from left to right
+            res.if_complete
+                = (left.if_perfect && right.if_complete && left.depth == right.depth)
+               || (left.if_complete && right.if_perfect && left.depth == right.depth + 1);
+            return res;
+        };
+        return ParallelFold(TheRoot, Shape {}, combine, cutoff).if_complete;
+    }
+    /// @brief same result as `emplace_filter`, `satisfied_func` must be thread safe
+    template <typename Func>
+    void emplace_filter_parallel(
+        Func&&     satisfied_func,
+        const bool if_inverse = false,
+        int        cutoff     = ParallelCutoff()
+    ) {
+        auto if_delete = [&](Node* node) {
+            return if_inverse ? satisfied_func(node->elem) : !satisfied_func(node->elem);
+        };
+        if (!TheRoot) {
+            return;
+        }
+        if (if_delete(TheRoot)) {
+            DeleteSubTree(TheRoot);
+            TheRoot = nullptr;
+            size    = 0;
+            return;
+        }
+        // res => num of deleted nodes in the sub tree
+        auto combine = [&](Node* node, int left, int right) {
+            int deleted = left + right;
+            if (node->left && if_delete(node->left)) {
+                deleted += DeleteSubTree(node->left);
+                node->left = nullptr;
+            }
+            if (node->right && if_delete(node->right)) {
+                deleted += DeleteSubTree(node->right);
+                node->right = nullptr;
+            }
+            return deleted;
+        };
+        size -= ParallelFold(TheRoot, 0, combine, cutoff);
+    }
+
     /// @brief @b filter(int_BiTree_supported_only)
     using filter_type = std::function<bool(const T&)>;
     void emplace_filter(
@@ -694,14 +1164,14 @@ public:
                 if (if_delete) {
                     if (node == TheRoot) {
                         // just delete everything
-                        PostOrderOpt(TheRoot, DeleteNode);
+                        PostOrderOpt(TheRoot, DeleteNode { this });
                         TheRoot = nullptr;
                         return;
                     }
                     bool if_on_left  = parent->left == node;
                     bool if_on_right = parent->right == node;
 
-                    PostOrderOpt(node, DeleteNode);
+                    PostOrderOpt(node, DeleteNode { this });
                     node = nullptr;
 
                     if_deleted_node = true;
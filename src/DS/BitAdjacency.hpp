@@ -0,0 +1,213 @@
+/**
+ * @file BitAdjacency.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Packed bit adjacency matrix for unweighted graphs, 64 arcs per word
+ * @structure: (row stride = 2 words)
+        Words => [ row 0: w0 w1 | row 1: w0 w1 | ... ]   bit `c % 64` of word `c / 64` <=> arc r -> c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b BitAdjacency
+/// 1 bit per (row, col) instead of an int => 32x smaller than `vector<int>`
+/// rows; degree is a popcount per word, neighbours come out in ascending
+/// order one `countr_zero` each, and set operations (BFS frontiers, common
+/// neighbours) work on 64 vertexes per instruction.
+/// The row stride doubles when it is full => adding a vertex is amortized
+/// O(V / 64) words, removing one moves the last row / col into the hole.
+/// Bits past the last vertex are always 0
+class BitAdjacency {
+public:
+    using Word = std::uint64_t;
+
+    static constexpr std::size_t WordBits = 64;
+
+private:
+    std::size_t num_of_vertex = 0;
+    std::size_t stride        = 0; // words per row (capacity)
+
+    std::vector<Word> Words;
+
+    static std::size_t words_for(std::size_t num_of_bit) { return (num_of_bit + WordBits - 1) / WordBits; }
+    static Word        bit_of(std::size_t col) { return Word { 1 } << (col % WordBits); }
+
+    Word*       row_data(std::size_t row) { return Words.data() + row * stride; }
+    const Word* row_data(std::size_t row) const { return Words.data() + row * stride; }
+
+    /// @brief @b widen => `new_stride` words per row
+    void widen(std::size_t new_stride) {
+        std::vector<Word> res(new_stride * num_of_vertex, 0);
+        for (std::size_t row = 0; row < num_of_vertex; ++row) {
+            std::copy(row_data(row), row_data(row) + stride, res.data() + row * new_stride);
+        }
+        Words  = std::move(res);
+        stride = new_stride;
+    }
+
+public:
+    BitAdjacency() = default;
+    explicit BitAdjacency(std::size_t num_of_vertex)
+        : num_of_vertex(num_of_vertex)
+        , stride(words_for(num_of_vertex))
+        , Words(stride * num_of_vertex, 0) { }
+
+    std::size_t size() const { return num_of_vertex; }
+    std::size_t get_num_of_word() const { return words_for(num_of_vertex); }
+    std::size_t get_num_of_byte() const { return Words.size() * sizeof(Word); }
+
+    /// @brief @b row => the used words of one row
+    std::span<const Word> row(std::size_t row) const { return { row_data(row), get_num_of_word() }; }
+
+    bool test(std::size_t row, std::size_t col) const { return row_data(row)[col / WordBits] & bit_of(col); }
+    void set(std::size_t row, std::size_t col) { row_data(row)[col / WordBits] |= bit_of(col); }
+    void reset(std::size_t row, std::size_t col) { row_data(row)[col / WordBits] &= ~bit_of(col); }
+
+    /// @brief @b degree => popcount of the row
+    std::size_t degree(std::size_t row) const {
+        std::size_t res = 0;
+        for (Word word : this->row(row)) {
+            res += static_cast<std::size_t>(std::popcount(word));
+        }
+        return res;
+    }
+    /// @brief @b for_each_neighbor, func(col) in ascending order
+    template <typename Func>
+    void for_each_neighbor(std::size_t row, Func&& func) const {
+        const Word* words = row_data(row);
+        for (std::size_t idx = 0; idx < get_num_of_word(); ++idx) {
+            for (Word bits = words[idx]; bits; bits &= bits - 1) {
+                func(idx * WordBits + static_cast<std::size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+    /// @brief @b first_neighbor, `size()` if none
+    std::size_t first_neighbor(std::size_t row) const {
+        const Word* words = row_data(row);
+        for (std::size_t idx = 0; idx < get_num_of_word(); ++idx) {
+            if (words[idx]) {
+                return idx * WordBits + static_cast<std::size_t>(std::countr_zero(words[idx]));
+            }
+        }
+        return num_of_vertex;
+    }
+    /// @brief @b intersect_count => |row a & row b|, the common neighbours
+    std::size_t intersect_count(std::size_t a_row, std::size_t b_row) const {
+        const Word* a   = row_data(a_row);
+        const Word* b   = row_data(b_row);
+        std::size_t res = 0;
+        for (std::size_t idx = 0; idx < get_num_of_word(); ++idx) {
+            res += static_cast<std::size_t>(std::popcount(a[idx] & b[idx]));
+        }
+        return res;
+    }
+    /// @brief @b count_triangles of a symmetric matrix (self loops ignored):
+    /// every a < b < c is counted once, from the arc (a, b), as the common
+    /// neighbours of a and b past b
+    std::size_t count_triangles() const {
+        std::size_t res = 0;
+        for (std::size_t a_row = 0; a_row < num_of_vertex; ++a_row) {
+            const Word* a = row_data(a_row);
+            for_each_neighbor(a_row, [&](std::size_t b_row) {
+                if (b_row <= a_row) {
+                    return;
+                }
+                const Word* b     = row_data(b_row);
+                std::size_t first = (b_row + 1) / WordBits;
+                if (first >= get_num_of_word()) {
+                    return;
+                }
+                // bits past b only in the first word
+                Word past = (b_row + 1) % WordBits ? ~Word { 0 } << ((b_row + 1) % WordBits) : ~Word { 0 };
+                res += static_cast<std::size_t>(std::popcount(a[first] & b[first] & past));
+                for (std::size_t idx = first + 1; idx < get_num_of_word(); ++idx) {
+                    res += static_cast<std::size_t>(std::popcount(a[idx] & b[idx]));
+                }
+            });
+        }
+        return res;
+    }
+    /// @brief @b hop_dist from `source`, -1 if unreachable. Every level is
+    /// the OR of the rows of the frontier minus the visited set
+    std::vector<int> hop_dist(std::size_t source) const {
+        const std::size_t num_of_word = get_num_of_word();
+        std::vector<int>  res(num_of_vertex, -1);
+        std::vector<Word> visited(num_of_word, 0);
+        std::vector<Word> frontier(num_of_word, 0);
+        std::vector<Word> next(num_of_word, 0);
+
+        res[source]                 = 0;
+        visited[source / WordBits]  = bit_of(source);
+        frontier[source / WordBits] = bit_of(source);
+        for (int level = 1;; ++level) {
+            std::fill(next.begin(), next.end(), 0);
+            for (std::size_t idx = 0; idx < num_of_word; ++idx) {
+                for (Word bits = frontier[idx]; bits; bits &= bits - 1) {
+                    const Word* words = row_data(idx * WordBits + static_cast<std::size_t>(std::countr_zero(bits)));
+                    for (std::size_t word = 0; word < num_of_word; ++word) {
+                        next[word] |= words[word];
+                    }
+                }
+            }
+            bool if_any = false;
+            for (std::size_t idx = 0; idx < num_of_word; ++idx) {
+                next[idx]    &= ~visited[idx];
+                visited[idx] |= next[idx];
+                if_any       |= next[idx] != 0;
+                for (Word bits = next[idx]; bits; bits &= bits - 1) {
+                    res[idx * WordBits + static_cast<std::size_t>(std::countr_zero(bits))] = level;
+                }
+            }
+            if (!if_any) {
+                return res;
+            }
+            frontier.swap(next);
+        }
+    }
+
+    /// @brief @b push_vertex => one more row and col, both empty
+    void push_vertex() {
+        if (num_of_vertex + 1 > stride * WordBits) {
+            widen(std::max<std::size_t>(1, stride * 2));
+        }
+        if ((num_of_vertex + 1) * stride > Words.size()) {
+            Words.resize(std::max(Words.size() * 2, (num_of_vertex + 1) * stride), 0);
+        }
+        ++num_of_vertex;
+    }
+    /// @brief @b swap_remove => the last row and col move into `idx`, O(V)
+    void swap_remove(std::size_t idx) {
+        const std::size_t last = num_of_vertex - 1;
+        // 1. col `idx` = col `last`, col `last` cleared
+        for (std::size_t row = 0; row < num_of_vertex; ++row) {
+            Word* words = row_data(row);
+            if (test(row, last)) {
+                words[idx / WordBits] |= bit_of(idx);
+            } else {
+                words[idx / WordBits] &= ~bit_of(idx);
+            }
+            words[last / WordBits] &= ~bit_of(last);
+        }
+        // 2. row `idx` = row `last`, row `last` cleared
+        if (idx != last) {
+            std::copy(row_data(last), row_data(last) + stride, row_data(idx));
+        }
+        std::fill(row_data(last), row_data(last) + stride, 0);
+        --num_of_vertex;
+    }
+};
+
+} // namespace DS
@@ -0,0 +1,221 @@
+/**
+ * @file CanonicalHuffman.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Canonical Huffman code, derived from code lengths only
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b PackedBitCode
+/// the lowest `length` bits of `bits`, sent from the most significant one
+struct PackedBitCode {
+    std::uint64_t bits   = 0;
+    std::uint8_t  length = 0;
+
+    friend bool operator==(const PackedBitCode&, const PackedBitCode&) = default;
+};
+
+/// @brief @b CanonicalHuffmanCode
+/// symbols are dense indexes `[0, num_of_symbol)`, length 0 => unused.
+/// codes of the same length are consecutive and ordered by symbol,
+/// so the length table alone is enough to rebuild the whole code
+class CanonicalHuffmanCode {
+public:
+    using LengthTable = std::vector<std::uint8_t>;
+
+    static constexpr int MaxCodeLength = 64;
+
+private:
+    LengthTable                Lengths;
+    std::vector<PackedBitCode> Codes;
+
+    /// @brief @b decoding_helpers (index => code length)
+    /// SortedSymbols => used symbols ordered by (length, symbol)
+    /// FirstCode[l]  => code of the first symbol of length `l`
+    /// FirstIndex[l] => its position in `SortedSymbols`
+    std::vector<std::uint32_t> SortedSymbols;
+    std::vector<std::uint64_t> FirstCode;
+    std::vector<std::uint32_t> FirstIndex;
+    std::vector<std::uint32_t> CountOfLength;
+
+    int max_length = 0;
+
+public:
+    /// @brief @b constructor => empty code, no symbol used
+    CanonicalHuffmanCode() = default;
+
+    /// @brief @b FromLengths, throws when the lengths are over-subscribed
+    static CanonicalHuffmanCode FromLengths(LengthTable lengths) {
+        CanonicalHuffmanCode res;
+        res.Lengths = std::move(lengths);
+        res.Codes.assign(res.Lengths.size(), PackedBitCode {});
+        res.CountOfLength.assign(MaxCodeLength + 1, 0);
+        for (std::uint8_t length : res.Lengths) {
+            if (length > MaxCodeLength) {
+                throw std::invalid_argument("Huffman code length is longer than 64 bits!");
+            }
+            ++res.CountOfLength[length];
+            res.max_length = std::max(res.max_length, static_cast<int>(length));
+        }
+        res.CountOfLength[0] = 0;
+
+        // Kraft inequality, `available` => free codes of the current length
+        const std::uint64_t num_of_symbol = res.Lengths.size();
+        std::uint64_t       available     = 1;
+        for (int length = 1; length <= res.max_length; ++length) {
+            available = std::min(available * 2, num_of_symbol + 1); // never overflows
+            if (available < res.CountOfLength[length]) {
+                throw std::invalid_argument("Huffman code lengths are over-subscribed!");
+            }
+            available -= res.CountOfLength[length];
+        }
+
+        res.FirstCode.assign(MaxCodeLength + 1, 0);
+        res.FirstIndex.assign(MaxCodeLength + 1, 0);
+        std::uint64_t code  = 0;
+        std::uint32_t index = 0;
+        for (int length = 1; length <= res.max_length; ++length) {
+            code  = (code + res.CountOfLength[length - 1]) << 1;
+            index += res.CountOfLength[length - 1];
+
+            res.FirstCode[length]  = code;
+            res.FirstIndex[length] = index;
+        }
+
+        res.SortedSymbols.resize(index + res.CountOfLength[res.max_length]);
+        std::vector<std::uint64_t> next_code  = res.FirstCode;
+        std::vector<std::uint32_t> next_index = res.FirstIndex;
+        for (std::size_t symbol = 0; symbol < res.Lengths.size(); ++symbol) {
+            std::uint8_t length = res.Lengths[symbol];
+            if (!length) {
+                continue;
+            }
+            res.Codes[symbol]                       = PackedBitCode { next_code[length]++, length };
+            res.SortedSymbols[next_index[length]++] = static_cast<std::uint32_t>(symbol);
+        }
+        return res;
+    }
+
+    /// @brief @b length_limited_code_lengths (package-merge)
+    /// optimal lengths under `length <= max_allowed`, weight 0 => unused
+    static LengthTable LimitedLengths(std::span<const std::uint64_t> weights, int max_allowed) {
+        LengthTable res(weights.size(), 0);
+
+        // leaves, sorted by weight
+        std::vector<std::uint32_t> leaves;
+        for (std::size_t symbol = 0; symbol < weights.size(); ++symbol) {
+            if (weights[symbol]) {
+                leaves.push_back(static_cast<std::uint32_t>(symbol));
+            }
+        }
+        const std::size_t num_of_leaf = leaves.size();
+        if (max_allowed < 1 || max_allowed > MaxCodeLength) {
+            throw std::invalid_argument("Unsupported max code length!");
+        }
+        if (num_of_leaf <= 1) {
+            for (std::uint32_t symbol : leaves) {
+                res[symbol] = 1; // a lone symbol still needs one bit
+            }
+            return res;
+        }
+        if (max_allowed < 64 && (std::uint64_t { 1 } << max_allowed) < num_of_leaf) {
+            throw std::invalid_argument("Too many symbols for the max code length!");
+        }
+        std::stable_sort(leaves.begin(), leaves.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return weights[a] < weights[b];
+        });
+
+        // if_leaf_at[level][i] => the i-th item of the merged list is a leaf,
+        // otherwise a package of two items from the level below
+        std::vector<std::vector<bool>> if_leaf_at(max_allowed);
+        std::vector<std::uint64_t>     list_weight;
+        std::vector<std::uint64_t>     next_weight;
+        for (std::uint32_t symbol : leaves) {
+            list_weight.push_back(weights[symbol]);
+        }
+        if_leaf_at[0].assign(num_of_leaf, true);
+        for (int level = 1; level < max_allowed; ++level) {
+            next_weight.clear();
+            std::vector<bool>& if_leaf  = if_leaf_at[level];
+            std::size_t        leaf_pos = 0;
+            std::size_t        pack_pos = 0;
+            std::size_t        num_pack = list_weight.size() / 2;
+            while (leaf_pos < num_of_leaf || pack_pos < num_pack) {
+                std::uint64_t pack = (pack_pos < num_pack)
+                    ? list_weight[2 * pack_pos] + list_weight[2 * pack_pos + 1]
+                    : 0;
+                bool take_leaf = leaf_pos < num_of_leaf
+                    && (pack_pos == num_pack || weights[leaves[leaf_pos]] <= pack);
+                if (take_leaf) {
+                    next_weight.push_back(weights[leaves[leaf_pos++]]);
+                } else {
+                    next_weight.push_back(pack);
+                    ++pack_pos;
+                }
+                if_leaf.push_back(take_leaf);
+            }
+            std::swap(list_weight, next_weight);
+        }
+
+        // take the cheapest 2n - 2 items on the top level, then trace down:
+        // each leaf taken adds one bit to its symbol
+        std::size_t num_taken = 2 * num_of_leaf - 2;
+        for (int level = max_allowed - 1; level >= 0; --level) {
+            std::size_t num_leaf_taken = 0;
+            for (std::size_t i = 0; i < num_taken; ++i) {
+                num_leaf_taken += if_leaf_at[level][i];
+            }
+            for (std::size_t i = 0; i < num_leaf_taken; ++i) {
+                ++res[leaves[i]];
+            }
+            num_taken = 2 * (num_taken - num_leaf_taken);
+        }
+        return res;
+    }
+
+    /// @brief @b getters
+    const LengthTable&                get_lengths() const { return Lengths; }
+    const std::vector<PackedBitCode>& get_codes() const { return Codes; }
+    const PackedBitCode&              operator[](std::size_t symbol) const { return Codes[symbol]; }
+    std::size_t                       get_num_of_symbol() const { return Codes.size(); }
+    int                               get_max_length() const { return max_length; }
+
+    const std::vector<std::uint32_t>& get_sorted_symbols() const { return SortedSymbols; }
+    std::uint64_t get_first_code(int length) const { return FirstCode[length]; }
+    std::uint32_t get_first_index(int length) const { return FirstIndex[length]; }
+    std::uint32_t get_count_of_length(int length) const { return CountOfLength[length]; }
+
+    /// @brief @b View_the_CodeBitSet
+    void EchoBitCode() const {
+        for (std::size_t symbol = 0; symbol < Codes.size(); ++symbol) {
+            const PackedBitCode& code = Codes[symbol];
+            if (!code.length) {
+                continue;
+            }
+            std::cout << symbol << " => ";
+            for (int bit = code.length - 1; bit >= 0; --bit) {
+                std::cout << ((code.bits >> bit) & 1);
+            }
+            std::cout << std::endl;
+        }
+        std::cout << std::endl;
+    }
+};
+
+} // namespace DS
@@ -0,0 +1,442 @@
+/**
+ * @file ConcurrentSkipList.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Concurrent ordered set (lazy skip list + epoch based reclamation)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b thread_slot => a small dense id for each live thread
+class ThreadSlot {
+public:
+    static constexpr int MaxThread = 128;
+
+private:
+    static inline std::atomic<bool> Used[MaxThread] {};
+
+    int id = -1;
+
+    ThreadSlot() {
+        for (int idx = 0; idx < MaxThread; ++idx) {
+            bool expected = false;
+            if (Used[idx].compare_exchange_strong(expected, true)) {
+                id = idx;
+                return;
+            }
+        }
+        throw std::runtime_error("Too many threads for `ThreadSlot`!");
+    }
+    ~ThreadSlot() {
+        Used[id].store(false);
+    }
+
+public:
+    static int get() {
+        thread_local ThreadSlot slot;
+        return slot.id;
+    }
+};
+
+/// @brief @b epoch_based_reclamation
+/// readers stay inside a `Guard`, a retired node is only freed after the
+/// global epoch has advanced twice, i.e. no reader could still see it
+template <typename Node>
+class EpochManager {
+    static constexpr std::uint64_t Idle           = UINT64_MAX;
+    static constexpr std::size_t   RetireBatch    = 64;
+    static constexpr int           CacheLine      = 64;
+    static constexpr int           MaxThread      = ThreadSlot::MaxThread;
+    static constexpr std::uint64_t SafeEpochDelta = 2;
+
+    struct alignas(CacheLine) Slot {
+        std::atomic<std::uint64_t> epoch { Idle };
+        int                        depth = 0; // nested guards, owner thread only
+    };
+
+    std::atomic<std::uint64_t> GlobalEpoch { 0 };
+    Slot                       Slots[MaxThread];
+
+    std::mutex                                   RetireLock;
+    std::vector<std::pair<std::uint64_t, Node*>> Retired; // (retired epoch, node)
+
+    bool try_advance() {
+        std::uint64_t curr = GlobalEpoch.load();
+        for (const Slot& slot : Slots) {
+            std::uint64_t seen = slot.epoch.load();
+            if (seen != Idle && seen != curr) {
+                return false;
+            }
+        }
+        return GlobalEpoch.compare_exchange_strong(curr, curr + 1);
+    }
+    void reclaim() {
+        std::uint64_t curr = GlobalEpoch.load();
+        std::size_t   kept = 0;
+        for (auto& [epoch, node] : Retired) {
+            if (curr >= epoch + SafeEpochDelta) {
+                delete node;
+            } else {
+                Retired[kept++] = std::make_pair(epoch, node);
+            }
+        }
+        Retired.resize(kept);
+    }
+
+public:
+    class Guard {
+        EpochManager& manager;
+        int           slot;
+
+    public:
+        /// @brief re-entrant: only the outermost guard publishes / clears the
+        /// epoch, an inner one (e.g. `contains` from a `for_each` callback)
+        /// must not mark the thread idle while the outer one still reads
+        explicit Guard(EpochManager& manager)
+            : manager(manager)
+            , slot(ThreadSlot::get()) {
+            if (manager.Slots[slot].depth++ == 0) {
+                manager.Slots[slot].epoch.store(manager.GlobalEpoch.load());
+            }
+        }
+        ~Guard() {
+            if (--manager.Slots[slot].depth == 0) {
+                manager.Slots[slot].epoch.store(Idle);
+            }
+        }
+        Guard(const Guard&)            = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    EpochManager() = default;
+    ~EpochManager() {
+        for (auto& [epoch, node] : Retired) {
+            delete node;
+        }
+    }
+    EpochManager(const EpochManager&)            = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+
+    void retire(Node* node) {
+        std::lock_guard<std::mutex> lock(RetireLock);
+        Retired.emplace_back(GlobalEpoch.load(), node);
+        if (Retired.size() >= RetireBatch) {
+            try_advance();
+            reclaim();
+        }
+    }
+};
+
+/// @brief @b lazy_skip_list (Herlihy, Lev, Luchangco & Shavit)
+/// `insert` and `remove` lock only the predecessors of the touched node,
+/// `contains` and range iteration are lock-free and never wait
+template <typename T>
+requires std::totally_ordered<T>
+class ConcurrentSkipList {
+    static constexpr int MaxLevel = 24; // enough for 2^24 elems at p = 1/2
+
+    class SpinLock {
+        std::atomic<bool> flag { false };
+
+    public:
+        void lock() {
+            while (flag.exchange(true, std::memory_order_acquire)) {
+                while (flag.load(std::memory_order_relaxed)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        void unlock() {
+            flag.store(false, std::memory_order_release);
+        }
+    };
+
+    /// `next[0, top_level]` lives right behind the node, in the same allocation
+    struct Node {
+        T                   elem {};
+        int                 top_level = 0;
+        std::atomic<bool>   marked { false };
+        std::atomic<bool>   fully_linked { false };
+        SpinLock            lock;
+        std::atomic<Node*>* next = nullptr;
+
+        Node(const T& elem, int top_level)
+            : elem(elem)
+            , top_level(top_level) {
+            init_next();
+        }
+        explicit Node(int top_level) // head sentinel
+            : top_level(top_level) {
+            init_next();
+        }
+        void init_next() {
+            next = reinterpret_cast<std::atomic<Node*>*>(this + 1);
+            for (int level = 0; level <= top_level; ++level) {
+                new (&next[level]) std::atomic<Node*>(nullptr);
+            }
+        }
+
+        static void* operator new(std::size_t size, int top_level) {
+            return ::operator new(size + (top_level + 1) * sizeof(std::atomic<Node*>));
+        }
+        static void operator delete(void* ptr) {
+            ::operator delete(ptr);
+        }
+        static void operator delete(void* ptr, int) {
+            ::operator delete(ptr);
+        }
+    };
+
+    Node*              Head = new (MaxLevel - 1) Node(MaxLevel - 1);
+    std::atomic<int>   size { 0 };
+    EpochManager<Node> Epoch;
+
+private:
+    static int random_level() {
+        thread_local std::mt19937 gen(std::random_device {}());
+        std::uint32_t             bits  = gen();
+        int                       level = 0;
+        while ((bits & 1) && level < MaxLevel - 1) {
+            ++level;
+            bits >>= 1;
+        }
+        return level;
+    }
+
+    /// @return highest level at which `elem` is found, or -1
+    int find(const T& elem, Node** preds, Node** succs) {
+        int   found = -1;
+        Node* pred  = Head;
+        for (int level = MaxLevel - 1; level >= 0; --level) {
+            Node* curr = pred->next[level].load(std::memory_order_acquire);
+            while (curr && curr->elem < elem) {
+                pred = curr;
+                curr = pred->next[level].load(std::memory_order_acquire);
+            }
+            if (found == -1 && curr && !(elem < curr->elem)) {
+                found = level;
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return found;
+    }
+    /// unlock the distinct predecessors of level [0, highest_locked]
+    static void unlock_preds(Node** preds, int highest_locked) {
+        Node* prev_pred = nullptr;
+        for (int level = 0; level <= highest_locked; ++level) {
+            if (preds[level] != prev_pred) {
+                preds[level]->lock.unlock();
+                prev_pred = preds[level];
+            }
+        }
+    }
+
+public:
+    ConcurrentSkipList() = default;
+    ~ConcurrentSkipList() {
+        Node* node = Head;
+        while (node) {
+            Node* next = node->next[0].load();
+            delete node;
+            node = next;
+        }
+    }
+    ConcurrentSkipList(const ConcurrentSkipList&)            = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    /// @brief @b size_related (exact when quiescent)
+    int  get_size() const { return size.load(); }
+    bool empty() const { return get_size() == 0; }
+
+    bool insert(const T& elem) {
+        int   top_level = random_level();
+        Node* preds[MaxLevel];
+        Node* succs[MaxLevel];
+
+        typename EpochManager<Node>::Guard guard(Epoch);
+        while (true) {
+            int found = find(elem, preds, succs);
+            if (found != -1) {
+                Node* node_found = succs[found];
+                if (!node_found->marked.load()) {
+                    // someone is inserting it, wait until it's visible
+                    while (!node_found->fully_linked.load()) {
+                        std::this_thread::yield();
+                    }
+                    return false;
+                }
+                continue; // it's being removed, retry
+            }
+            // lock & validate all predecessors
+            int   highest_locked = -1;
+            bool  if_valid       = true;
+            Node* prev_pred      = nullptr;
+            for (int level = 0; if_valid && level <= top_level; ++level) {
+                Node* pred = preds[level];
+                Node* succ = succs[level];
+                if (pred != prev_pred) {
+                    pred->lock.lock();
+                    highest_locked = level;
+                    prev_pred      = pred;
+                }
+                if_valid = !pred->marked.load()
+                    && (!succ || !succ->marked.load())
+                    && pred->next[level].load() == succ;
+            }
+            if (!if_valid) {
+                unlock_preds(preds, highest_locked);
+                continue;
+            }
+            // link bottom-up
+            Node* node = new (top_level) Node(elem, top_level);
+            for (int level = 0; level <= top_level; ++level) {
+                node->next[level].store(succs[level], std::memory_order_relaxed);
+            }
+            for (int level = 0; level <= top_level; ++level) {
+                preds[level]->next[level].store(node, std::memory_order_release);
+            }
+            node->fully_linked.store(true);
+            unlock_preds(preds, highest_locked);
+            ++size;
+            return true;
+        }
+    }
+
+    bool remove(const T& elem) {
+        Node* victim    = nullptr;
+        bool  if_marked = false;
+        int   top_level = -1;
+        Node* preds[MaxLevel];
+        Node* succs[MaxLevel];
+
+        typename EpochManager<Node>::Guard guard(Epoch);
+        while (true) {
+            int found = find(elem, preds, succs);
+            if (found != -1) {
+                victim = succs[found];
+            }
+            bool if_removable = if_marked
+                || (found != -1
+                    && victim->fully_linked.load()
+                    && victim->top_level == found
+                    && !victim->marked.load());
+            if (!if_removable) {
+                return false;
+            }
+            // 1. logical removal
+            if (!if_marked) {
+                top_level = victim->top_level;
+                victim->lock.lock();
+                if (victim->marked.load()) {
+                    victim->lock.unlock();
+                    return false;
+                }
+                victim->marked.store(true);
+                if_marked = true;
+            }
+            // 2. lock & validate all predecessors
+            int   highest_locked = -1;
+            bool  if_valid       = true;
+            Node* prev_pred      = nullptr;
+            for (int level = 0; if_valid && level <= top_level; ++level) {
+                Node* pred = preds[level];
+                if (pred != prev_pred) {
+                    pred->lock.lock();
+                    highest_locked = level;
+                    prev_pred      = pred;
+                }
+                if_valid = !pred->marked.load() && pred->next[level].load() == victim;
+            }
+            if (!if_valid) {
+                unlock_preds(preds, highest_locked);
+                continue;
+            }
+            // 3. physical removal, top-down
+            for (int level = top_level; level >= 0; --level) {
+                preds[level]->next[level].store(
+                    victim->next[level].load(std::memory_order_relaxed),
+                    std::memory_order_release
+                );
+            }
+            victim->lock.unlock();
+            unlock_preds(preds, highest_locked);
+            --size;
+            Epoch.retire(victim);
+            return true;
+        }
+    }
+
+    bool contains(const T& elem) {
+        Node* preds[MaxLevel];
+        Node* succs[MaxLevel];
+
+        typename EpochManager<Node>::Guard guard(Epoch);
+        int found = find(elem, preds, succs);
+        return found != -1
+            && succs[found]->fully_linked.load()
+            && !succs[found]->marked.load();
+    }
+
+    /// @brief @b range_iteration => func(elem) for elems in [lo, hi], ascending
+    /// weakly consistent: sees every elem present during the whole call
+    template <typename Func>
+    void for_each_in_range(const T& lo, const T& hi, Func&& func) {
+        typename EpochManager<Node>::Guard guard(Epoch);
+
+        Node* pred = Head;
+        for (int level = MaxLevel - 1; level >= 0; --level) {
+            Node* curr = pred->next[level].load(std::memory_order_acquire);
+            while (curr && curr->elem < lo) {
+                pred = curr;
+                curr = pred->next[level].load(std::memory_order_acquire);
+            }
+        }
+        Node* curr = pred->next[0].load(std::memory_order_acquire);
+        while (curr && !(hi < curr->elem)) {
+            if (curr->fully_linked.load() && !curr->marked.load()) {
+                func(curr->elem);
+            }
+            curr = curr->next[0].load(std::memory_order_acquire);
+        }
+    }
+    template <typename Func>
+    void for_each(Func&& func) {
+        typename EpochManager<Node>::Guard guard(Epoch);
+
+        Node* curr = Head->next[0].load(std::memory_order_acquire);
+        while (curr) {
+            if (curr->fully_linked.load() && !curr->marked.load()) {
+                func(curr->elem);
+            }
+            curr = curr->next[0].load(std::memory_order_acquire);
+        }
+    }
+
+    void print_list() {
+        for_each([](const T& elem) {
+            std::cout << elem << " ";
+        });
+        std::cout << std::endl;
+    }
+};
+
+} // namespace DS
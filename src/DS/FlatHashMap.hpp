@@ -0,0 +1,248 @@
+/**
+ * @file FlatHashMap.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Open addressing hash map, one control byte per slot, SIMD probing
+ * @structure:
+        Ctrl  => [ 0x80 | h2 | 0xFE | ... ]  16 per group: empty / 7-bit hash / deleted
+        Slots => [ {} | {k, v} | {} | ... ]  one pair per control byte
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DS_FLAT_HASH_SSE2 1
+#endif
+
+namespace DS {
+
+/// @brief @b FlatHashMap
+/// a lookup hashes once, then compares the 7-bit hash of the key with the
+/// 16 control bytes of one group in a single SIMD compare; only the matches
+/// touch `Slots`. Groups are probed quadratically, a group with an empty
+/// byte ends the search. `erase` leaves a tombstone only if the group is
+/// full, tombstones are dropped by the next rehash.
+/// Key and Value must be default constructible (slots are plain pairs)
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+requires std::is_default_constructible_v<Key> && std::is_default_constructible_v<Value>
+class FlatHashMap {
+    using Slot = std::pair<Key, Value>;
+
+    static constexpr std::size_t   GroupSize = 16;
+    static constexpr std::int8_t   Empty     = -128; // 0b1000'0000
+    static constexpr std::int8_t   Deleted   = -2;   // 0b1111'1110
+    static constexpr std::size_t   NotFound  = static_cast<std::size_t>(-1);
+    static constexpr std::uint64_t Golden    = 0x9E37'79B9'7F4A'7C15ULL;
+
+    std::vector<std::int8_t> Ctrl; // full => 0 .. 127
+    std::vector<Slot>        Slots;
+
+    std::size_t num_of_elem    = 0;
+    std::size_t num_of_deleted = 0;
+
+    /// @brief bit `i` set <=> ctrl[i] == byte
+    static std::uint32_t match(const std::int8_t* group, std::int8_t byte) {
+#ifdef DS_FLAT_HASH_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(byte))));
+#else
+        std::uint32_t res = 0;
+        for (std::size_t idx = 0; idx < GroupSize; ++idx) {
+            res |= static_cast<std::uint32_t>(group[idx] == byte) << idx;
+        }
+        return res;
+#endif
+    }
+    /// @brief bit `i` set <=> ctrl[i] is empty or deleted (the sign bit)
+    static std::uint32_t match_free(const std::int8_t* group) {
+#ifdef DS_FLAT_HASH_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+        std::uint32_t res = 0;
+        for (std::size_t idx = 0; idx < GroupSize; ++idx) {
+            res |= static_cast<std::uint32_t>(group[idx] < 0) << idx;
+        }
+        return res;
+#endif
+    }
+
+    /// @brief std::hash of an integer is the integer => mixed first
+    static std::size_t hash_of(const Key& key) {
+        std::uint64_t res = static_cast<std::uint64_t>(Hash {}(key)) * Golden;
+        return static_cast<std::size_t>(res ^ (res >> 29));
+    }
+    static std::int8_t h2_of(std::size_t hash) { return static_cast<std::int8_t>(hash & 0x7F); }
+
+    std::size_t get_num_of_group() const { return Ctrl.size() / GroupSize; }
+
+    /// @brief @b find_index => slot of `key`, or `NotFound`
+    std::size_t find_index(const Key& key, std::size_t hash) const {
+        if (Ctrl.empty()) {
+            return NotFound;
+        }
+        const std::size_t group_mask = get_num_of_group() - 1;
+        std::size_t       group      = (hash >> 7) & group_mask;
+        for (std::size_t probe = 1; probe <= get_num_of_group(); ++probe) {
+            const std::int8_t* ctrl = Ctrl.data() + group * GroupSize;
+            for (std::uint32_t bits = match(ctrl, h2_of(hash)); bits; bits &= bits - 1) {
+                std::size_t idx = group * GroupSize + static_cast<std::size_t>(std::countr_zero(bits));
+                if (KeyEqual {}(Slots[idx].first, key)) {
+                    return idx;
+                }
+            }
+            if (match(ctrl, Empty)) {
+                return NotFound;
+            }
+            group = (group + probe) & group_mask; // triangular => every group once
+        }
+        return NotFound;
+    }
+    /// @brief @b find_free => first empty or deleted slot on the probe sequence
+    std::size_t find_free(std::size_t hash) const {
+        const std::size_t group_mask = get_num_of_group() - 1;
+        std::size_t       group      = (hash >> 7) & group_mask;
+        for (std::size_t probe = 1;; ++probe) {
+            std::uint32_t bits = match_free(Ctrl.data() + group * GroupSize);
+            if (bits) {
+                return group * GroupSize + static_cast<std::size_t>(std::countr_zero(bits));
+            }
+            group = (group + probe) & group_mask;
+        }
+    }
+
+    /// @brief @b rehash into `num_of_slot` slots (a power of 2, >= GroupSize)
+    void rehash(std::size_t num_of_slot) {
+        std::vector<std::int8_t> old_ctrl  = std::exchange(Ctrl, std::vector<std::int8_t>(num_of_slot, Empty));
+        std::vector<Slot>        old_slots = std::exchange(Slots, std::vector<Slot>(num_of_slot));
+        num_of_deleted                     = 0;
+        for (std::size_t idx = 0; idx < old_ctrl.size(); ++idx) {
+            if (old_ctrl[idx] >= 0) {
+                std::size_t hash = hash_of(old_slots[idx].first);
+                std::size_t dest = find_free(hash);
+                Ctrl[dest]       = h2_of(hash);
+                Slots[dest]      = std::move(old_slots[idx]);
+            }
+        }
+    }
+    /// @brief at most 7 / 8 of the slots used (tombstones included)
+    void make_room_for_one() {
+        if ((num_of_elem + num_of_deleted + 1) * 8 <= Ctrl.size() * 7) {
+            return;
+        }
+        std::size_t num_of_slot = std::max(GroupSize, Ctrl.size());
+        while ((num_of_elem + 1) * 16 > num_of_slot * 7) { // grow unless tombstones were the problem
+            num_of_slot *= 2;
+        }
+        rehash(num_of_slot);
+    }
+    /// @brief @b insert_index => slot of `key`, inserted if missing
+    std::size_t insert_index(const Key& key, bool& if_inserted) {
+        std::size_t hash = hash_of(key);
+        std::size_t idx  = find_index(key, hash);
+        if_inserted      = idx == NotFound;
+        if (!if_inserted) {
+            return idx;
+        }
+        make_room_for_one();
+        idx = find_free(hash);
+        num_of_deleted -= (Ctrl[idx] == Deleted);
+        Ctrl[idx]        = h2_of(hash);
+        Slots[idx].first = key;
+        ++num_of_elem;
+        return idx;
+    }
+
+public:
+    FlatHashMap() = default;
+
+    std::size_t size() const { return num_of_elem; }
+    bool        empty() const { return num_of_elem == 0; }
+    void        clear() {
+        Ctrl.clear();
+        Slots.clear();
+        num_of_elem    = 0;
+        num_of_deleted = 0;
+    }
+    void reserve(std::size_t num) {
+        std::size_t num_of_slot = GroupSize;
+        while (num * 8 > num_of_slot * 7) {
+            num_of_slot *= 2;
+        }
+        if (num_of_slot > Ctrl.size()) {
+            rehash(num_of_slot);
+        }
+    }
+
+    /// @brief @b find => pointer to the value, `nullptr` if missing
+    Value* find(const Key& key) {
+        std::size_t idx = find_index(key, hash_of(key));
+        return (idx == NotFound) ? nullptr : &Slots[idx].second;
+    }
+    const Value* find(const Key& key) const {
+        std::size_t idx = find_index(key, hash_of(key));
+        return (idx == NotFound) ? nullptr : &Slots[idx].second;
+    }
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    /// @brief @b at, throws `std::out_of_range` if missing
+    Value& at(const Key& key) {
+        Value* res = find(key);
+        if (!res) {
+            throw std::out_of_range("Key is NOT exist!");
+        }
+        return *res;
+    }
+    const Value& at(const Key& key) const {
+        const Value* res = find(key);
+        if (!res) {
+            throw std::out_of_range("Key is NOT exist!");
+        }
+        return *res;
+    }
+    /// @brief @b operator[], a missing key gets a default value
+    Value& operator[](const Key& key) {
+        bool if_inserted = false;
+        return Slots[insert_index(key, if_inserted)].second;
+    }
+    /// @brief @b insert_or_assign, true if `key` was missing
+    bool insert_or_assign(const Key& key, Value value) {
+        bool if_inserted                            = false;
+        Slots[insert_index(key, if_inserted)].second = std::move(value);
+        return if_inserted;
+    }
+    /// @brief @b erase, true if `key` was there
+    bool erase(const Key& key) {
+        std::size_t idx = find_index(key, hash_of(key));
+        if (idx == NotFound) {
+            return false;
+        }
+        // no probe goes past a group with an empty byte => no tombstone needed
+        const std::int8_t* group = Ctrl.data() + idx / GroupSize * GroupSize;
+        if (match(group, Empty)) {
+            Ctrl[idx] = Empty;
+        } else {
+            Ctrl[idx] = Deleted;
+            ++num_of_deleted;
+        }
+        Slots[idx] = Slot {};
+        --num_of_elem;
+        return true;
+    }
+};
+
+} // namespace DS
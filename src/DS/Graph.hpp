@@ -10,9 +10,17 @@
  */
 
 // Adj Table => Storage Core
+// one unsorted arc list per vertex => insert / delete of an arc is O(degree),
+// insert of a vertex is amortized O(1), delete of a vertex is O(degree) plus
+// the scans of the neighbours' lists (the last vertex moves into the hole)
+// an unweighted graph may opt into a bit matrix instead (`if_bitset`):
+// 1 bit per arc, popcount degree, word-parallel BFS / triangle counting
 
 #pragma once
 
+#include "BitAdjacency.hpp"
+#include "FlatHashMap.hpp"
+
 #include <algorithm>
 #include <iostream>
 #include <limits>
@@ -21,7 +29,6 @@
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -41,6 +48,8 @@ class Prim;
 
 namespace DS {
 
+class GraphSnapshot;
+
 template <class T>
 concept Printable = requires(T a, std::ostream& b) {
                         { b << a };
@@ -53,10 +62,16 @@ class Graph {
     friend class Algo::Floyd<T>;
     friend class Algo::Kruskal<T>;
     friend class Algo::Prim<T>;
+    friend class GraphSnapshot;
 
 public:
-    using MatType    = std::vector<std::vector<int>>;
-    using MatRowType = std::vector<int>;
+    /// @brief one arc, kept in the list of one of its two ends
+    struct Arc {
+        int To     = 0;
+        int Weight = 0; // 1 for an unweighted graph
+    };
+    using AdjRowType = std::vector<Arc>;
+    using AdjType    = std::vector<AdjRowType>;
 
     using EdgeList         = std::vector<std::pair<T, T>>;
     using WeightedEdgeList = std::vector<std::tuple<T, T, int>>;
@@ -67,39 +82,149 @@ public:
     static constexpr int LIM = -1; // This won't cause overflow!
 
 private:
-    std::vector<std::vector<int>> Mat;
-    std::unordered_map<T, int>    V_Index_Map;
-    std::unordered_map<int, T>    Index_V_Map;
+    AdjType             OutAdj;      // arcs leaving the vertex (both halves if undirected)
+    AdjType             InAdj;       // arcs entering the vertex (directed only)
+    BitAdjacency        Bits;        // row => col, replaces both lists if `if_bitset`
+    FlatHashMap<T, int> V_Index_Map; // name => index
+    std::vector<T>      Index_V_Map; // index => name
 
     int  size        = 0;
     bool if_directed = false;
     bool if_weighted = false;
+    bool if_bitset   = false;
 
     Graph() = default;
     void copy_from(const Graph& copied) {
-        Mat         = copied.Mat;
+        OutAdj      = copied.OutAdj;
+        InAdj       = copied.InAdj;
+        Bits        = copied.Bits;
         V_Index_Map = copied.V_Index_Map;
         Index_V_Map = copied.Index_V_Map;
         size        = copied.size;
         if_directed = copied.if_directed;
         if_weighted = copied.if_weighted;
+        if_bitset   = copied.if_bitset;
     }
     void move_from(Graph& moved) {
-        Mat         = std::move(moved.Mat);
+        OutAdj      = std::move(moved.OutAdj);
+        InAdj       = std::move(moved.InAdj);
+        Bits        = std::move(moved.Bits);
         V_Index_Map = std::move(moved.V_Index_Map);
         Index_V_Map = std::move(moved.Index_V_Map);
         size        = std::move(moved.size);
         if_directed = std::move(moved.if_directed);
         if_weighted = std::move(moved.if_weighted);
+        if_bitset   = std::move(moved.if_bitset);
     }
-    void init_mat(const int& the_size) {
-        int value = (if_weighted) ? LIM : 0;
-        Mat       = MatType(the_size, MatRowType(the_size, value));
-        if (if_weighted) {
-            for (int idx = 0; idx < size; ++idx) {
-                Mat[idx][idx] = 0;
+    void init_adj(const int& the_size) {
+        if (if_bitset) {
+            Bits = BitAdjacency(the_size);
+            return;
+        }
+        OutAdj = AdjType(the_size);
+        InAdj  = AdjType(if_directed ? the_size : 0);
+    }
+    /// @brief the lists holding the other half of every arc
+    AdjType& reverse_adj() {
+        return (if_directed) ? InAdj : OutAdj;
+    }
+
+    /// @brief @b arc_list_opt, all O(degree)
+    static void set_arc(AdjRowType& row, int to, int weight) {
+        auto iter = std::find_if(row.begin(), row.end(), [&](const Arc& arc) { return arc.To == to; });
+        if (iter != row.end()) {
+            iter->Weight = weight;
+        } else {
+            row.push_back({ to, weight });
+        }
+    }
+    static void erase_arc(AdjRowType& row, int to) {
+        auto iter = std::find_if(row.begin(), row.end(), [&](const Arc& arc) { return arc.To == to; });
+        if (iter != row.end()) {
+            *iter = row.back();
+            row.pop_back();
+        }
+    }
+    static void rename_arc(AdjRowType& row, int old_to, int new_to) {
+        auto iter = std::find_if(row.begin(), row.end(), [&](const Arc& arc) { return arc.To == old_to; });
+        if (iter != row.end()) {
+            iter->To = new_to;
+        }
+    }
+    /// @brief @b swap_remove_from_lists => `DeleteVex` of the list storage
+    void swap_remove_from_lists(const int& del_idx, const int& last_idx) {
+        // 1. drop every arc of `del_idx` from the lists of its other ends
+        AdjRowType out_arcs = std::move(OutAdj[del_idx]);
+        OutAdj[del_idx].clear();
+        for (const Arc& arc : out_arcs) {
+            if (arc.To != del_idx) {
+                erase_arc(reverse_adj()[arc.To], del_idx);
             }
         }
+        if (if_directed) {
+            AdjRowType in_arcs = std::move(InAdj[del_idx]);
+            InAdj[del_idx].clear();
+            for (const Arc& arc : in_arcs) {
+                if (arc.To != del_idx) {
+                    erase_arc(OutAdj[arc.To], del_idx);
+                }
+            }
+        }
+        // 2. move the last vertex into the hole, rename it at its other ends
+        if (del_idx != last_idx) {
+            for (const Arc& arc : OutAdj[last_idx]) {
+                if (arc.To != last_idx) {
+                    rename_arc(reverse_adj()[arc.To], last_idx, del_idx);
+                }
+            }
+            OutAdj[del_idx] = std::move(OutAdj[last_idx]);
+            rename_arc(OutAdj[del_idx], last_idx, del_idx); // self loop
+            if (if_directed) {
+                for (const Arc& arc : InAdj[last_idx]) {
+                    if (arc.To != last_idx) {
+                        rename_arc(OutAdj[arc.To], last_idx, del_idx);
+                    }
+                }
+                InAdj[del_idx] = std::move(InAdj[last_idx]);
+                rename_arc(InAdj[del_idx], last_idx, del_idx);
+            }
+        }
+        OutAdj.pop_back();
+        if (if_directed) {
+            InAdj.pop_back();
+        }
+    }
+
+    /// @brief @b get_cost => the old matrix entry: weight / 0 on the diagonal /
+    /// LIM if weighted, 1 / 0 if not
+    int get_cost(const int& from_idx, const int& to_idx) const {
+        if (if_bitset) {
+            return Bits.test(from_idx, to_idx);
+        }
+        for (const Arc& arc : OutAdj[from_idx]) {
+            if (arc.To == to_idx) {
+                return arc.Weight;
+            }
+        }
+        if (!if_weighted) {
+            return 0;
+        }
+        return (from_idx == to_idx) ? 0 : LIM;
+    }
+    /// @brief @b get_cost_row => the old matrix row, O(size + degree)
+    std::vector<int> get_cost_row(const int& from_idx) const {
+        std::vector<int> res(size, (if_weighted) ? LIM : 0);
+        if (if_weighted) {
+            res[from_idx] = 0;
+        }
+        if (if_bitset) {
+            Bits.for_each_neighbor(from_idx, [&](std::size_t to_idx) { res[to_idx] = 1; });
+            return res;
+        }
+        for (const Arc& arc : OutAdj[from_idx]) {
+            res[arc.To] = arc.Weight;
+        }
+        return res;
     }
 
 public:
@@ -128,23 +253,30 @@ public:
     constexpr Graph(
         const VertexList& VexInit,
         const Edge&       EdgeInit,
-        const bool&       if_directed = false
+        const bool&       if_directed = false,
+        const bool&       if_bitset   = false
     ) {
         this->if_directed = if_directed;
+        this->if_bitset   = if_bitset;
         if constexpr (std::is_same_v<Edge, WEdgeList>) {
             this->if_weighted = true;
+            if (if_bitset) {
+                throw std::logic_error("Bitset adjacency requires an `Unweighted_Graph`!");
+            }
         }
         // 1. import vertex
         const int& num_of_v = VexInit.size();
         size                = num_of_v;
         int curr_idx        = 0;
+        V_Index_Map.reserve(VexInit.size());
+        Index_V_Map.reserve(VexInit.size());
         for (auto&& curr_vex : VexInit) {
             V_Index_Map[curr_vex] = curr_idx;
-            Index_V_Map[curr_idx] = curr_vex;
+            Index_V_Map.push_back(curr_vex);
             ++curr_idx;
         }
-        // 2. init Mat
-        init_mat(size);
+        // 2. init adjacency
+        init_adj(size);
         // 3. add edges
         if constexpr (std::is_same_v<Edge, WEdgeList>) {
             for (auto&& [a_vex, b_vex, weight] : EdgeInit) {
@@ -182,11 +314,8 @@ public:
         }
     }
     int GetIndex(const T& v_name) {
-        int res = -1;
-        if (V_Index_Map.contains(v_name)) {
-            res = V_Index_Map[v_name];
-        }
-        return res;
+        const int* res = V_Index_Map.find(v_name);
+        return (res) ? *res : -1;
     }
     T GetVex(const int& index) {
         if (index < 0 || index >= size) {
@@ -200,46 +329,42 @@ public:
             return;
         }
         // 1. update map
-        const int& curr_inserted_idx   = size;
-        V_Index_Map[NewVex]            = curr_inserted_idx;
-        Index_V_Map[curr_inserted_idx] = NewVex;
+        V_Index_Map[NewVex] = size;
+        Index_V_Map.push_back(NewVex);
         // 2. update size
         ++size;
-        // 3. update Mat
-        Mat.resize(size);
-        int value = (if_weighted) ? LIM : 0;
-        for (std::vector<int>& row_vec : Mat) {
-            row_vec.push_back(value);
+        // 3. update adjacency
+        if (if_bitset) {
+            Bits.push_vertex();
+            return;
+        }
+        OutAdj.emplace_back();
+        if (if_directed) {
+            InAdj.emplace_back();
         }
-        auto&& new_row = std::vector<int>(size, value);
-        Mat.emplace_back(new_row);
     }
     void DeleteVex(const T& DelVex) {
         if (!if_has_vex(DelVex)) {
             throw std::logic_error("Input Vertex is NOT exist!");
             // return;
         }
-        int DelIdx = V_Index_Map[DelVex];
-
-        MatType    NewMat;
-        MatRowType TempRow;
-        NewMat.reserve(size);
-        TempRow.reserve(size);
-        for (int row_idx = 0; row_idx < size; ++row_idx) {
-            if (row_idx == DelIdx) {
-                continue;
-            }
-            for (int col_idx = 0; col_idx < size; ++col_idx) {
-                if (col_idx == DelIdx) {
-                    continue;
-                }
-                TempRow.emplace_back(Mat[row_idx][col_idx]);
-            }
-            NewMat.emplace_back(TempRow);
-            TempRow.clear();
+        const int del_idx  = V_Index_Map[DelVex];
+        const int last_idx = size - 1;
+        // 1. drop `del_idx` from the adjacency, the last vertex takes its index
+        if (if_bitset) {
+            Bits.swap_remove(del_idx);
+        } else {
+            swap_remove_from_lists(del_idx, last_idx);
         }
-
-        Mat = std::move(NewMat);
+        // 2. rename the last vertex
+        if (del_idx != last_idx) {
+            V_Index_Map[Index_V_Map[last_idx]] = del_idx;
+            Index_V_Map[del_idx]               = std::move(Index_V_Map[last_idx]);
+        }
+        // 3. update map and size
+        V_Index_Map.erase(DelVex);
+        Index_V_Map.pop_back();
+        --size;
     }
     /// @brief @b arc_opt
     void ArcOpt(
@@ -248,21 +373,34 @@ public:
         const bool& if_delete = false,
         const int&  weight    = 0
     ) {
-        if (!if_has_vex(from_vex) || !if_has_vex(to_vex)) {
+        const int* from_ptr = V_Index_Map.find(from_vex);
+        const int* to_ptr   = V_Index_Map.find(to_vex);
+        if (!from_ptr || !to_ptr) {
             throw std::logic_error("Undirected graph doesn't contain all of input vertexes!");
         }
-        int from_idx = V_Index_Map[from_vex];
-        int to_idx   = V_Index_Map[to_vex];
-        if (!if_weighted) {
-            Mat[from_idx][to_idx] = (if_delete) ? 0 : 1;
-            if (!if_directed) {
-                Mat[to_idx][from_idx] = (if_delete) ? 0 : 1;
+        int from_idx = *from_ptr;
+        int to_idx   = *to_ptr;
+        if (if_bitset) {
+            if (if_delete) {
+                Bits.reset(from_idx, to_idx);
+                if (!if_directed) {
+                    Bits.reset(to_idx, from_idx);
+                }
+            } else {
+                Bits.set(from_idx, to_idx);
+                if (!if_directed) {
+                    Bits.set(to_idx, from_idx);
+                }
             }
+            return;
+        }
+        if (if_delete) {
+            erase_arc(OutAdj[from_idx], to_idx);
+            erase_arc(reverse_adj()[to_idx], from_idx);
         } else {
-            Mat[from_idx][to_idx] = (if_delete) ? LIM : weight;
-            if (!if_directed) {
-                Mat[to_idx][from_idx] = (if_delete) ? LIM : weight;
-            }
+            int value = (if_weighted) ? weight : 1;
+            set_arc(OutAdj[from_idx], to_idx, value);
+            set_arc(reverse_adj()[to_idx], from_idx, value);
         }
     }
     void InsertArc(
@@ -307,47 +445,113 @@ public:
         make_sure_has_vex(b_vex);
         const int& a_idx = V_Index_Map[a_vex];
         const int& b_idx = V_Index_Map[b_vex];
-        return Mat[a_idx][b_idx]; //==> LIM / 0 / weight
+        return get_cost(a_idx, b_idx); //==> LIM / 0 / weight
     }
 
 public:
+    bool if_adj(const Arc& arc) const {
+        if (if_weighted) {
+            return arc.Weight != 0 && arc.Weight != LIM;
+        }
+        return arc.Weight != 0;
+    }
     int FindAdjIndex(const T& v_name) {
         if (!if_has_vex(v_name)) {
             return -1;
         }
-        int ret       = -1;
-        int input_idx = GetIndex(v_name);
-        for (int col_idx = 0; col_idx < size; ++col_idx) {
-            bool if_adj = false;
-            if (if_weighted) {
-                if_adj = Mat[input_idx][col_idx] != 0
-                    && Mat[input_idx][col_idx] != LIM;
-            } else {
-                if_adj = Mat[input_idx][col_idx] != 0;
-            }
-            if (if_adj) {
-                ret = input_idx;
-                break;
+        if (if_bitset) {
+            const std::size_t res = Bits.first_neighbor(GetIndex(v_name));
+            return (res == Bits.size()) ? -1 : static_cast<int>(res);
+        }
+        int ret = -1;
+        for (const Arc& arc : OutAdj[GetIndex(v_name)]) {
+            if (if_adj(arc) && (ret == -1 || arc.To < ret)) {
+                ret = arc.To;
             }
         }
         return ret;
     }
+    /// @brief ascending, as the old matrix scan
     std::vector<int> FindAllAdjIndex(const T& v_name) {
         std::vector<int> res;
         if (!if_has_vex(v_name)) {
             return res;
         }
-        int input_idx = GetIndex(v_name);
-        for (int col_idx = 0; col_idx < size; ++col_idx) {
-            bool if_adj = false;
-            if (if_weighted) {
-                if_adj = Mat[input_idx][col_idx] != 0
-                    && Mat[input_idx][col_idx] != LIM;
-            } else {
-                if_adj = Mat[input_idx][col_idx] != 0;
+        if (if_bitset) {
+            Bits.for_each_neighbor(GetIndex(v_name), [&](std::size_t to_idx) { res.push_back(static_cast<int>(to_idx)); });
+            return res;
+        }
+        for (const Arc& arc : OutAdj[GetIndex(v_name)]) {
+            if (if_adj(arc)) {
+                res.push_back(arc.To);
+            }
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+    int GetDegree(const T& v_name) {
+        make_sure_has_vex(v_name);
+        if (if_bitset) {
+            return static_cast<int>(Bits.degree(GetIndex(v_name)));
+        }
+        return static_cast<int>(OutAdj[GetIndex(v_name)].size());
+    }
+    int GetVexNum() const {
+        return size;
+    }
+    bool IfBitset() const {
+        return if_bitset;
+    }
+
+public:
+    /// @brief @b bit_parallel_queries, with a list fallback
+    /// @b CountTriangles => every {a, b, c} once, self loops ignored
+    long long CountTriangles() {
+        make_sure_undirected();
+        if (if_bitset) {
+            return static_cast<long long>(Bits.count_triangles());
+        }
+        // mark the higher neighbours of a, then walk the higher neighbours of each b
+        long long         res = 0;
+        std::vector<char> marked(size, 0);
+        for (int a_idx = 0; a_idx < size; ++a_idx) {
+            for (const Arc& arc : OutAdj[a_idx]) {
+                marked[arc.To] = (arc.To > a_idx);
+            }
+            for (const Arc& ab : OutAdj[a_idx]) {
+                if (ab.To <= a_idx) {
+                    continue;
+                }
+                for (const Arc& bc : OutAdj[ab.To]) {
+                    res += (bc.To > ab.To) && marked[bc.To];
+                }
             }
-            if (if_adj) {
-                res.push_back(col_idx);
+            for (const Arc& arc : OutAdj[a_idx]) {
+                marked[arc.To] = 0;
+            }
+        }
+        return res;
+    }
+    /// @brief @b GetHopDist => arcs on the shortest path from `source` to every
+    /// index, -1 if unreachable
+    std::vector<int> GetHopDist(const T& source) {
+        make_sure_has_vex(source);
+        const int source_idx = GetIndex(source);
+        if (if_bitset) {
+            return Bits.hop_dist(source_idx);
+        }
+        std::vector<int> res(size, -1);
+        std::queue<int>  index_queue;
+        res[source_idx] = 0;
+        index_queue.push(source_idx);
+        while (!index_queue.empty()) {
+            int curr_idx = index_queue.front();
+            index_queue.pop();
+            for (const Arc& arc : OutAdj[curr_idx]) {
+                if (if_adj(arc) && res[arc.To] == -1) {
+                    res[arc.To] = res[curr_idx] + 1;
+                    index_queue.push(arc.To);
+                }
             }
         }
         return res;
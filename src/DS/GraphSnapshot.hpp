@@ -0,0 +1,313 @@
+/**
+ * @file GraphSnapshot.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Versioned binary snapshot of a Graph, mapped back read-only
+ * @structure: (native byte order, every section 8-byte aligned)
+        Header                                  magic, version, flags, counts, section offsets
+        Offsets     => uint64 [V + 1]           arcs of vertex i => [Offsets[i], Offsets[i + 1])
+        Neighbors   => uint32 [E]               ascending per vertex (both halves if undirected)
+        Weights     => int32  [E]               weighted graphs only
+        NameOffsets => uint64 [V + 1]           name of vertex i => Names[NameOffsets[i] ..)
+        NameOrder   => uint32 [V]               indexes sorted by name => binary search lookup
+        Names       => char   [NameOffsets[V]]  every name printed with `<<`, back to back
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../tools/MappedFile.hpp"
+#include "Graph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b GraphSnapshot
+/// `save` writes a Graph as CSR; opening maps the file and only checks the
+/// header and the section bounds => O(1) whatever the size, pages are read
+/// by the OS when they are touched. The snapshot is a read-only view:
+/// arcs by index, weights, and names both ways (name => index is a binary
+/// search over `NameOrder`, nothing is hashed at load time).
+/// `check_all` walks every arc, O(V + E), for files of unknown origin
+class GraphSnapshot {
+public:
+    static constexpr char          Magic[8]  = { 'D', 'S', 'G', 'R', 'A', 'P', 'H', '\0' };
+    static constexpr std::uint32_t Version   = 1;
+    static constexpr std::uint32_t ByteOrder = 0x0102'0304;
+
+    static constexpr std::uint32_t DirectedFlag = 1;
+    static constexpr std::uint32_t WeightedFlag = 2;
+
+    struct Header {
+        char          magic[8]         = {};
+        std::uint32_t version          = 0;
+        std::uint32_t byte_order       = 0; // `ByteOrder` as written
+        std::uint32_t flags            = 0;
+        std::uint32_t reserved         = 0;
+        std::uint64_t num_of_vertex    = 0;
+        std::uint64_t num_of_arc       = 0;
+        std::uint64_t num_of_name_byte = 0;
+        std::uint64_t offsets_at       = 0;
+        std::uint64_t neighbors_at     = 0;
+        std::uint64_t weights_at       = 0; // 0 if unweighted
+        std::uint64_t name_offsets_at  = 0;
+        std::uint64_t name_order_at    = 0;
+        std::uint64_t names_at         = 0;
+        std::uint64_t file_size        = 0;
+    };
+    static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 104);
+
+private:
+    Tool::MappedFile file;
+    Header           header;
+
+    std::span<const std::uint64_t> Offsets;
+    std::span<const std::uint32_t> Neighbors;
+    std::span<const std::int32_t>  Weights;
+    std::span<const std::uint64_t> NameOffsets;
+    std::span<const std::uint32_t> NameOrder;
+    std::string_view               Names;
+
+    static std::runtime_error broken(const std::string& what) {
+        return std::runtime_error("Broken graph snapshot: " + what);
+    }
+    static std::uint64_t align_up(std::uint64_t pos) { return (pos + 7) / 8 * 8; }
+
+    /// @brief @b section => `num` elements at byte `at`, bounds / alignment checked
+    template <typename Elem>
+    std::span<const Elem> section(std::uint64_t at, std::uint64_t num, const char* name) const {
+        if (at % alignof(Elem) || at > file.get_size() || num > (file.get_size() - at) / sizeof(Elem)) {
+            throw broken(std::string(name) + " out of the file");
+        }
+        return { reinterpret_cast<const Elem*>(file.bytes().data() + at), static_cast<std::size_t>(num) };
+    }
+
+    /// @brief every vertex name as text, `std::string`-like names as they are
+    template <typename T>
+    static std::string name_of(const T& vex) {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return std::string(std::string_view(vex));
+        } else {
+            std::ostringstream out;
+            out << vex;
+            return out.str();
+        }
+    }
+
+public:
+    /// @brief @b open => map `path`, O(1)
+    explicit GraphSnapshot(const std::string& path)
+        : file(path) {
+        if (file.get_size() < sizeof(Header)) {
+            throw broken("shorter than the header");
+        }
+        std::memcpy(&header, file.bytes().data(), sizeof(Header));
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+            throw broken("bad magic");
+        }
+        if (header.byte_order != ByteOrder) {
+            throw std::runtime_error("Graph snapshot written with another byte order!");
+        }
+        if (header.version != Version) {
+            throw std::runtime_error("Unsupported graph snapshot version: " + std::to_string(header.version));
+        }
+        if (header.file_size != file.get_size()) {
+            throw broken("truncated");
+        }
+        if (header.num_of_vertex > std::numeric_limits<std::uint32_t>::max()) {
+            throw broken("too many vertexes");
+        }
+        const std::uint64_t num_of_vertex = header.num_of_vertex;
+        Offsets                           = section<std::uint64_t>(header.offsets_at, num_of_vertex + 1, "offsets");
+        Neighbors                         = section<std::uint32_t>(header.neighbors_at, header.num_of_arc, "neighbors");
+        if (header.flags & WeightedFlag) {
+            Weights = section<std::int32_t>(header.weights_at, header.num_of_arc, "weights");
+        }
+        NameOffsets = section<std::uint64_t>(header.name_offsets_at, num_of_vertex + 1, "name offsets");
+        NameOrder   = section<std::uint32_t>(header.name_order_at, num_of_vertex, "name order");
+        Names       = { reinterpret_cast<const char*>(section<char>(header.names_at, header.num_of_name_byte, "names").data()),
+                        static_cast<std::size_t>(header.num_of_name_byte) };
+        if (Offsets.front() != 0 || Offsets.back() != header.num_of_arc) {
+            throw broken("offsets do not cover the arcs");
+        }
+        if (NameOffsets.front() != 0 || NameOffsets.back() != header.num_of_name_byte) {
+            throw broken("name offsets do not cover the names");
+        }
+    }
+
+    /// @brief @b check_all => monotone offsets, indexes in range, O(V + E)
+    void check_all() const {
+        const std::size_t num_of_vertex = get_vex_num();
+        for (std::size_t idx = 0; idx < num_of_vertex; ++idx) {
+            if (Offsets[idx] > Offsets[idx + 1] || NameOffsets[idx] > NameOffsets[idx + 1]) {
+                throw broken("offsets are not monotone");
+            }
+            if (NameOrder[idx] >= num_of_vertex) {
+                throw broken("name order out of range");
+            }
+        }
+        for (std::uint32_t to : Neighbors) {
+            if (to >= num_of_vertex) {
+                throw broken("neighbor out of range");
+            }
+        }
+    }
+
+    /// @brief @b save => `path`, overwritten; arcs that `graph` would not
+    /// report as adjacent (LIM, 0) are dropped
+    template <typename T>
+    static void save(const std::string& path, const Graph<T>& graph) {
+        using Arc = typename Graph<T>::Arc;
+
+        const std::size_t num_of_vertex = static_cast<std::size_t>(graph.size);
+        // 1. CSR of the out arcs, ascending per vertex
+        std::vector<std::uint64_t> offsets(num_of_vertex + 1, 0);
+        std::vector<std::uint32_t> neighbors;
+        std::vector<std::int32_t>  weights;
+        std::vector<Arc>           row;
+        for (std::size_t idx = 0; idx < num_of_vertex; ++idx) {
+            row.clear();
+            if (graph.if_bitset) {
+                graph.Bits.for_each_neighbor(idx, [&](std::size_t to) { row.push_back({ static_cast<int>(to), 1 }); });
+            } else {
+                for (const Arc& arc : graph.OutAdj[idx]) {
+                    if (graph.if_adj(arc)) {
+                        row.push_back(arc);
+                    }
+                }
+                std::sort(row.begin(), row.end(), [](const Arc& a, const Arc& b) { return a.To < b.To; });
+            }
+            for (const Arc& arc : row) {
+                neighbors.push_back(static_cast<std::uint32_t>(arc.To));
+                if (graph.if_weighted) {
+                    weights.push_back(arc.Weight);
+                }
+            }
+            offsets[idx + 1] = neighbors.size();
+        }
+        // 2. name table, and the indexes sorted by name
+        std::vector<std::uint64_t> name_offsets(num_of_vertex + 1, 0);
+        std::string                names;
+        for (std::size_t idx = 0; idx < num_of_vertex; ++idx) {
+            names += name_of(graph.Index_V_Map[idx]);
+            name_offsets[idx + 1] = names.size();
+        }
+        auto name_at = [&](std::uint32_t idx) {
+            return std::string_view(names).substr(name_offsets[idx], name_offsets[idx + 1] - name_offsets[idx]);
+        };
+        std::vector<std::uint32_t> name_order(num_of_vertex);
+        std::iota(name_order.begin(), name_order.end(), 0);
+        std::sort(name_order.begin(), name_order.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return name_at(a) < name_at(b);
+        });
+        // 3. layout
+        Header header;
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version          = Version;
+        header.byte_order       = ByteOrder;
+        header.flags            = (graph.if_directed ? DirectedFlag : 0) | (graph.if_weighted ? WeightedFlag : 0);
+        header.num_of_vertex    = num_of_vertex;
+        header.num_of_arc       = neighbors.size();
+        header.num_of_name_byte = names.size();
+        header.offsets_at       = align_up(sizeof(Header));
+        header.neighbors_at     = align_up(header.offsets_at + offsets.size() * sizeof(std::uint64_t));
+        header.weights_at       = (graph.if_weighted) ? align_up(header.neighbors_at + neighbors.size() * sizeof(std::uint32_t)) : 0;
+        header.name_offsets_at  = align_up(
+            (graph.if_weighted) ? header.weights_at + weights.size() * sizeof(std::int32_t)
+                                 : header.neighbors_at + neighbors.size() * sizeof(std::uint32_t)
+        );
+        header.name_order_at = align_up(header.name_offsets_at + name_offsets.size() * sizeof(std::uint64_t));
+        header.names_at      = align_up(header.name_order_at + name_order.size() * sizeof(std::uint32_t));
+        header.file_size     = header.names_at + names.size();
+
+        // 4. write, zero padding up to every section
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        std::uint64_t written = 0;
+        auto          put     = [&](std::uint64_t at, const void* data, std::size_t num_of_byte) {
+            static constexpr char zeros[8] = {};
+            out.write(zeros, static_cast<std::streamsize>(at - written));
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(num_of_byte));
+            written = at + num_of_byte;
+        };
+        put(0, &header, sizeof(Header));
+        put(header.offsets_at, offsets.data(), offsets.size() * sizeof(std::uint64_t));
+        put(header.neighbors_at, neighbors.data(), neighbors.size() * sizeof(std::uint32_t));
+        if (graph.if_weighted) {
+            put(header.weights_at, weights.data(), weights.size() * sizeof(std::int32_t));
+        }
+        put(header.name_offsets_at, name_offsets.data(), name_offsets.size() * sizeof(std::uint64_t));
+        put(header.name_order_at, name_order.data(), name_order.size() * sizeof(std::uint32_t));
+        put(header.names_at, names.data(), names.size());
+        if (!out) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }
+
+public:
+    /// @brief @b getters
+    const Header& get_header() const { return header; }
+    bool          if_directed() const { return header.flags & DirectedFlag; }
+    bool          if_weighted() const { return header.flags & WeightedFlag; }
+    std::size_t   get_vex_num() const { return static_cast<std::size_t>(header.num_of_vertex); }
+    std::size_t   get_arc_num() const { return static_cast<std::size_t>(header.num_of_arc); }
+
+    /// @brief @b neighbors => ascending indexes of the out arcs of `idx`
+    std::span<const std::uint32_t> neighbors(std::size_t idx) const {
+        return Neighbors.subspan(Offsets[idx], Offsets[idx + 1] - Offsets[idx]);
+    }
+    /// @brief @b weights => parallel to `neighbors(idx)`, empty if unweighted
+    std::span<const std::int32_t> weights(std::size_t idx) const {
+        if (Weights.empty()) {
+            return {};
+        }
+        return Weights.subspan(Offsets[idx], Offsets[idx + 1] - Offsets[idx]);
+    }
+    std::size_t degree(std::size_t idx) const { return Offsets[idx + 1] - Offsets[idx]; }
+    /// @brief @b get_weight of the arc from => to (1 if unweighted), O(log degree)
+    std::optional<int> get_weight(std::size_t from, std::size_t to) const {
+        auto row  = neighbors(from);
+        auto iter = std::lower_bound(row.begin(), row.end(), to);
+        if (iter == row.end() || *iter != to) {
+            return std::nullopt;
+        }
+        return (Weights.empty()) ? 1 : weights(from)[iter - row.begin()];
+    }
+
+    /// @brief @b name of `idx`, as printed by `save`
+    std::string_view name(std::size_t idx) const {
+        return Names.substr(NameOffsets[idx], NameOffsets[idx + 1] - NameOffsets[idx]);
+    }
+    /// @brief @b find => index of `v_name`, -1 if missing, O(log V)
+    long long find(std::string_view v_name) const {
+        auto iter = std::lower_bound(NameOrder.begin(), NameOrder.end(), v_name, [&](std::uint32_t idx, std::string_view key) {
+            return name(idx) < key;
+        });
+        if (iter == NameOrder.end() || name(*iter) != v_name) {
+            return -1;
+        }
+        return *iter;
+    }
+};
+
+} // namespace DS
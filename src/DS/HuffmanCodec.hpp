@@ -0,0 +1,546 @@
+/**
+ * @file HuffmanCodec.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Byte oriented Huffman compressor built on HuffmanTree
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../tools/Parallel.hpp"
+#include "CanonicalHuffman.hpp"
+#include "HuffmanTree.hpp"
+#include "SymbolHistogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b BitWriter
+/// MSB first, bits are gathered in a 64-bit word and flushed 32 at a time
+class BitWriter {
+    std::vector<std::uint8_t>& Out;
+
+    std::uint64_t acc      = 0;
+    int           num_bits = 0; // always < 32 between calls
+
+public:
+    explicit BitWriter(std::vector<std::uint8_t>& out)
+        : Out(out) { }
+
+    void write(std::uint64_t bits, int length) {
+        if (length > 32) {
+            write(bits >> 32, length - 32);
+            bits &= 0xFFFF'FFFF;
+            length = 32;
+        }
+        acc       = (acc << length) | bits;
+        num_bits += length;
+        if (num_bits >= 32) {
+            num_bits -= 32;
+            auto word = static_cast<std::uint32_t>(acc >> num_bits);
+            Out.push_back(static_cast<std::uint8_t>(word >> 24));
+            Out.push_back(static_cast<std::uint8_t>(word >> 16));
+            Out.push_back(static_cast<std::uint8_t>(word >> 8));
+            Out.push_back(static_cast<std::uint8_t>(word));
+            acc &= (std::uint64_t { 1 } << num_bits) - 1;
+        }
+    }
+    /// @brief pad the last byte with zero bits
+    void flush() {
+        while (num_bits > 0) {
+            int shift = num_bits - 8;
+            Out.push_back(static_cast<std::uint8_t>(shift >= 0 ? acc >> shift : acc << -shift));
+            num_bits = std::max(shift, 0);
+            acc &= (std::uint64_t { 1 } << num_bits) - 1;
+        }
+    }
+};
+
+/// @brief @b BitReader
+/// MSB first, `acc` is left aligned and holds at least 56 bits after
+/// `refill()` => zero bits are fed after the end of the input
+class BitReader {
+public:
+    static constexpr int RefillBits = 56;
+
+private:
+    std::span<const std::uint8_t> In;
+
+    std::size_t   pos      = 0;
+    std::uint64_t acc      = 0;
+    int           num_bits = 0;
+
+public:
+    explicit BitReader(std::span<const std::uint8_t> in)
+        : In(in) { }
+
+    void refill() {
+        if (pos + 8 <= In.size()) {
+            std::uint64_t word = 0;
+            for (int i = 0; i < 8; ++i) { // compiles to one load + bswap
+                word = (word << 8) | In[pos + i];
+            }
+            acc |= word >> num_bits;
+            pos += (63 - num_bits) >> 3;
+            num_bits |= 56;
+            return;
+        }
+        while (num_bits <= 56) {
+            std::uint64_t byte = (pos < In.size()) ? In[pos] : 0;
+            ++pos;
+            acc |= byte << (56 - num_bits);
+            num_bits += 8;
+        }
+    }
+    std::uint64_t peek(int length) const { return acc >> (64 - length); }
+    std::uint64_t peek_all() const { return acc; }
+    void          consume(int length) {
+        acc <<= length;
+        num_bits -= length;
+    }
+    /// @brief true once bits after the end of the input were consumed
+    bool if_overrun() const {
+        return pos > In.size() && (pos - In.size()) * 8 > static_cast<std::size_t>(num_bits);
+    }
+};
+
+/// @brief @b HuffmanEncoder
+/// streaming, `encode` could be called on consecutive chunks
+class HuffmanEncoder {
+    std::array<PackedBitCode, 256> Codes {};
+    BitWriter                      Writer;
+
+public:
+    HuffmanEncoder(const CanonicalHuffmanCode& code, std::vector<std::uint8_t>& out)
+        : Writer(out) {
+        for (std::size_t symbol = 0; symbol < code.get_num_of_symbol() && symbol < 256; ++symbol) {
+            Codes[symbol] = code[symbol];
+        }
+    }
+    void encode(std::span<const std::uint8_t> in) {
+        for (std::uint8_t symbol : in) {
+            const PackedBitCode& code = Codes[symbol];
+            if (!code.length) {
+                throw std::invalid_argument("Symbol has no Huffman code!");
+            }
+            Writer.write(code.bits, code.length);
+        }
+    }
+    void finish() { Writer.flush(); }
+};
+
+/// @brief @b HuffmanDecoder
+/// one lookup of the next `PrimaryBits` bits yields every symbol whose
+/// code fits completely in them (up to 3), longer codes take the
+/// canonical slow path
+class HuffmanDecoder {
+public:
+    static constexpr int PrimaryBits   = 11;
+    static constexpr int MaxSymbolHits = 3;
+
+private:
+    struct Entry {
+        std::uint8_t symbols[MaxSymbolHits] = {};
+        std::uint8_t num_of_symbol          = 0; // 0 => first code is longer
+        std::uint8_t first_length           = 0;
+        std::uint8_t total_length           = 0;
+    };
+
+    CanonicalHuffmanCode Code; // owned => a temporary code cannot dangle
+    std::vector<Entry>   Table;
+
+    int min_length = 0; // shortest code, 0 => no code
+
+    /// @brief canonical decode of a left aligned word, length 0 => invalid
+    std::pair<std::uint32_t, int> decode_slow(std::uint64_t word, int min_length, int max_length) const {
+        for (int length = min_length; length <= max_length; ++length) {
+            std::uint64_t code   = word >> (64 - length);
+            std::uint64_t offset = code - Code.get_first_code(length);
+            if (offset < Code.get_count_of_length(length)) {
+                return { Code.get_sorted_symbols()[Code.get_first_index(length) + offset], length };
+            }
+        }
+        return { 0, 0 };
+    }
+
+    /// @brief bits of `in` can not hold more than `in.size() * 8 / min_length`
+    /// symbols => checked before anything is sized by an untrusted count
+    void make_sure_fits(std::span<const std::uint8_t> in, std::uint64_t num_of_symbol) const {
+        if (!Code.get_max_length()) {
+            throw std::runtime_error("Broken Huffman stream (no code). ");
+        }
+        if (num_of_symbol > get_max_symbols(in.size())) {
+            throw std::runtime_error("Broken Huffman stream (too many symbols). ");
+        }
+    }
+
+public:
+    explicit HuffmanDecoder(CanonicalHuffmanCode code)
+        : Code(std::move(code))
+        , Table(std::size_t { 1 } << PrimaryBits) {
+        if (Code.get_max_length() > BitReader::RefillBits) {
+            throw std::invalid_argument("Huffman code is longer than one refill (56 bits)!");
+        }
+        for (int length = 1; length <= Code.get_max_length() && !min_length; ++length) {
+            min_length = (Code.get_count_of_length(length)) ? length : 0;
+        }
+        const int max_length = std::min(Code.get_max_length(), PrimaryBits);
+        for (std::uint64_t peek = 0; peek < Table.size(); ++peek) {
+            Entry&        entry = Table[peek];
+            std::uint64_t word  = peek << (64 - PrimaryBits);
+            int           used  = 0;
+            while (entry.num_of_symbol < MaxSymbolHits) {
+                auto [symbol, length] = decode_slow(word, 1, std::min(max_length, PrimaryBits - used));
+                if (!length) {
+                    break;
+                }
+                entry.symbols[entry.num_of_symbol++] = static_cast<std::uint8_t>(symbol);
+                if (entry.num_of_symbol == 1) {
+                    entry.first_length = static_cast<std::uint8_t>(length);
+                }
+                used += length;
+                word <<= length;
+            }
+            entry.total_length = static_cast<std::uint8_t>(used);
+        }
+    }
+
+    /// @brief upper bound of the symbols in `num_of_byte` bytes of bits
+    std::uint64_t get_max_symbols(std::uint64_t num_of_byte) const {
+        return (min_length) ? num_of_byte * 8 / static_cast<std::uint64_t>(min_length) : 0;
+    }
+
+    /// @brief decode exactly `num_of_symbol` symbols, appended to `out`
+    void decode(std::span<const std::uint8_t> in, std::size_t num_of_symbol, std::vector<std::uint8_t>& out) const {
+        if (num_of_symbol) {
+            make_sure_fits(in, num_of_symbol);
+        }
+        const std::size_t beg = out.size();
+        out.resize(beg + num_of_symbol);
+        decode(in, num_of_symbol, out.data() + beg);
+    }
+    /// @brief decode exactly `num_of_symbol` symbols into [dst, dst + num)
+    /// nothing after the range is touched => blocks could share one buffer
+    void decode(std::span<const std::uint8_t> in, std::size_t num_of_symbol, std::uint8_t* dst) const {
+        if (!num_of_symbol) {
+            return;
+        }
+        make_sure_fits(in, num_of_symbol);
+        std::size_t remain = num_of_symbol;
+        BitReader   reader(in);
+        while (remain) {
+            reader.refill();
+            // 56 bits => at least 4 primary lookups before the next refill
+            for (int round = 0; round < 4 && remain; ++round) {
+                const Entry& entry = Table[reader.peek(PrimaryBits)];
+                if (entry.num_of_symbol && remain >= MaxSymbolHits) {
+                    for (int i = 0; i < MaxSymbolHits; ++i) { // fixed trip count => unrolled
+                        dst[i] = entry.symbols[i];
+                    }
+                    dst    += entry.num_of_symbol;
+                    remain -= entry.num_of_symbol;
+                    reader.consume(entry.total_length);
+                } else if (entry.num_of_symbol) {
+                    *dst++ = entry.symbols[0];
+                    --remain;
+                    reader.consume(entry.first_length);
+                } else {
+                    reader.refill(); // a long code may need all 56 bits
+                    auto [symbol, length] = decode_slow(reader.peek_all(), PrimaryBits + 1, Code.get_max_length());
+                    if (!length) {
+                        throw std::runtime_error("Broken Huffman stream (invalid code). ");
+                    }
+                    *dst++ = static_cast<std::uint8_t>(symbol);
+                    --remain;
+                    reader.consume(length);
+                    break; // long code => refill first
+                }
+            }
+        }
+        if (reader.if_overrun()) {
+            throw std::runtime_error("Broken Huffman stream (truncated). ");
+        }
+    }
+};
+
+/// @brief @b HuffmanCodec
+/// [magic "HUF1"] [u64 LE: num of bytes] [256 x u8: code lengths] [bits]
+class HuffmanCodec {
+public:
+    static constexpr char MagicNumber[4] = { 'H', 'U', 'F', '1' };
+    static constexpr int  HeaderSize     = 4 + 8 + 256;
+    static constexpr int  MaxCodeLength  = 32; // <= 56, what one refill gives
+
+    using Histogram = std::array<std::uint64_t, 256>;
+
+    static Histogram count(std::span<const std::uint8_t> in) {
+        return SymbolHistogram::count_bytes(in);
+    }
+    /// @brief canonical code (length limited) from a byte histogram
+    static CanonicalHuffmanCode build_code(const Histogram& histogram) {
+        std::uint64_t total = 0;
+        for (std::uint64_t count : histogram) {
+            total += count;
+        }
+        CanonicalHuffmanCode::LengthTable lengths;
+        if (total <= INT32_MAX) {
+            auto init = HuffmanTree<std::uint8_t>::init_from_counts(histogram);
+            lengths   = HuffmanTree<std::uint8_t>(init).get_canonical_code(MaxCodeLength).get_lengths();
+        } else {
+            // HuffmanTree weights are int => exact lengths without the tree
+            lengths = CanonicalHuffmanCode::LimitedLengths(histogram, MaxCodeLength);
+        }
+        lengths.resize(256, 0);
+        return CanonicalHuffmanCode::FromLengths(std::move(lengths));
+    }
+
+    static void write_header(std::vector<std::uint8_t>& out, std::uint64_t num_of_byte, const CanonicalHuffmanCode& code) {
+        out.insert(out.end(), MagicNumber, MagicNumber + 4);
+        for (int i = 0; i < 8; ++i) {
+            out.push_back(static_cast<std::uint8_t>(num_of_byte >> (8 * i)));
+        }
+        out.insert(out.end(), code.get_lengths().begin(), code.get_lengths().end());
+    }
+    static std::pair<std::uint64_t, CanonicalHuffmanCode> read_header(std::span<const std::uint8_t> in) {
+        if (in.size() < HeaderSize || std::memcmp(in.data(), MagicNumber, 4) != 0) {
+            throw std::runtime_error("Not a Huffman stream. ");
+        }
+        std::uint64_t num_of_byte = 0;
+        for (int i = 7; i >= 0; --i) {
+            num_of_byte = (num_of_byte << 8) | in[4 + i];
+        }
+        return { num_of_byte, code_from_lengths(in.subspan(12, 256)) };
+    }
+    /// @brief @b code_from_lengths, the 256 lengths of an untrusted header:
+    /// nothing longer than `MaxCodeLength` (never written), no over-subscription
+    static CanonicalHuffmanCode code_from_lengths(std::span<const std::uint8_t> lengths) {
+        for (std::uint8_t length : lengths) {
+            if (length > MaxCodeLength) {
+                throw std::runtime_error("Broken Huffman stream (code length). ");
+            }
+        }
+        try {
+            return CanonicalHuffmanCode::FromLengths(CanonicalHuffmanCode::LengthTable(lengths.begin(), lengths.end()));
+        } catch (const std::invalid_argument&) {
+            throw std::runtime_error("Broken Huffman stream (code lengths). ");
+        }
+    }
+
+    /// @brief @b in_memory
+    static std::vector<std::uint8_t> compress(std::span<const std::uint8_t> in) {
+        std::vector<std::uint8_t> res;
+        CanonicalHuffmanCode      code = build_code(count(in));
+        res.reserve(HeaderSize + in.size() / 2);
+        write_header(res, in.size(), code);
+        HuffmanEncoder encoder(code, res);
+        encoder.encode(in);
+        encoder.finish();
+        return res;
+    }
+    static std::vector<std::uint8_t> decompress(std::span<const std::uint8_t> in) {
+        auto [num_of_byte, code] = read_header(in);
+        std::vector<std::uint8_t> res;
+        HuffmanDecoder(std::move(code)).decode(in.subspan(HeaderSize), num_of_byte, res);
+        return res;
+    }
+
+    /// @brief @b file_to_file (two passes over the input, chunked)
+    static constexpr std::size_t ChunkSize = 1 << 20;
+
+    static void compress_file(const std::string& in_path, const std::string& out_path) {
+        std::ifstream in(in_path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open " + in_path);
+        }
+        std::vector<std::uint8_t> chunk(ChunkSize);
+        auto                      for_each_chunk = [&](auto&& func) {
+            in.clear();
+            in.seekg(0);
+            while (in) {
+                in.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+                func(std::span<const std::uint8_t>(chunk.data(), static_cast<std::size_t>(in.gcount())));
+            }
+        };
+        Histogram     histogram {};
+        std::uint64_t num_of_byte = 0;
+        for_each_chunk([&](std::span<const std::uint8_t> part) {
+            Histogram part_histogram = count(part);
+            for (int symbol = 0; symbol < 256; ++symbol) {
+                histogram[symbol] += part_histogram[symbol];
+            }
+            num_of_byte += part.size();
+        });
+        CanonicalHuffmanCode code = build_code(histogram);
+
+        std::ofstream out(out_path, std::ios::binary);
+        if (!out) {
+            throw std::runtime_error("Cannot open " + out_path);
+        }
+        std::vector<std::uint8_t> buffer;
+        write_header(buffer, num_of_byte, code);
+        HuffmanEncoder encoder(code, buffer);
+        auto           drain = [&] {
+            out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        };
+        for_each_chunk([&](std::span<const std::uint8_t> part) {
+            encoder.encode(part);
+            drain();
+        });
+        encoder.finish();
+        drain();
+    }
+    static void decompress_file(const std::string& in_path, const std::string& out_path) {
+        std::ifstream in(in_path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open " + in_path);
+        }
+        std::vector<std::uint8_t> compressed(
+            (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>()
+        );
+        std::vector<std::uint8_t> res = decompress(compressed);
+        std::ofstream             out(out_path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(res.data()), static_cast<std::streamsize>(res.size()));
+    }
+};
+
+/// @brief @b BlockHuffmanCodec
+/// blocks are encoded / decoded independently with one shared code
+/// [magic "HUFB"] [u64 LE: num of bytes] [u32 LE: block size]
+/// [256 x u8: code lengths] [num of block x u64 LE: end offset of block]
+/// [bits of block 0] [bits of block 1] ...
+class BlockHuffmanCodec {
+public:
+    static constexpr char        MagicNumber[4]   = { 'H', 'U', 'F', 'B' };
+    static constexpr int         HeaderSize       = 4 + 8 + 4 + 256;
+    static constexpr std::size_t DefaultBlockSize = 1 << 20;
+
+    using Histogram = HuffmanCodec::Histogram;
+
+    /// @brief per-thread histograms over contiguous slices, then merged
+    static Histogram count(std::span<const std::uint8_t> in, unsigned num_of_thread = Tool::num_of_worker()) {
+        return SymbolHistogram::count_bytes(in, num_of_thread);
+    }
+
+    static std::vector<std::uint8_t> compress(
+        std::span<const std::uint8_t> in,
+        std::size_t                   block_size    = DefaultBlockSize,
+        unsigned                      num_of_thread = Tool::num_of_worker()
+    ) {
+        if (!block_size || block_size > UINT32_MAX) {
+            throw std::invalid_argument("Unsupported block size!");
+        }
+        const std::size_t    num_of_block = (in.size() + block_size - 1) / block_size;
+        CanonicalHuffmanCode code         = HuffmanCodec::build_code(count(in, num_of_thread));
+
+        std::vector<std::vector<std::uint8_t>> blocks(num_of_block);
+        Tool::parallel_for(
+            num_of_block,
+            [&](std::size_t idx) {
+                auto part = in.subspan(idx * block_size, std::min(block_size, in.size() - idx * block_size));
+                blocks[idx].reserve(part.size() / 2);
+                HuffmanEncoder encoder(code, blocks[idx]);
+                encoder.encode(part);
+                encoder.finish();
+            },
+            num_of_thread
+        );
+
+        std::vector<std::uint8_t> res;
+        std::size_t               total = 0;
+        for (auto& block : blocks) {
+            total += block.size();
+        }
+        res.reserve(HeaderSize + 8 * num_of_block + total);
+        res.insert(res.end(), MagicNumber, MagicNumber + 4);
+        write_le(res, in.size(), 8);
+        write_le(res, block_size, 4);
+        res.insert(res.end(), code.get_lengths().begin(), code.get_lengths().end());
+        std::uint64_t end_offset = 0;
+        for (auto& block : blocks) {
+            end_offset += block.size();
+            write_le(res, end_offset, 8);
+        }
+        for (auto& block : blocks) {
+            res.insert(res.end(), block.begin(), block.end());
+        }
+        return res;
+    }
+
+    static std::vector<std::uint8_t> decompress(
+        std::span<const std::uint8_t> in,
+        unsigned                      num_of_thread = Tool::num_of_worker()
+    ) {
+        if (in.size() < HeaderSize || std::memcmp(in.data(), MagicNumber, 4) != 0) {
+            throw std::runtime_error("Not a block Huffman stream. ");
+        }
+        const std::uint64_t num_of_byte = read_le(in.subspan(4), 8);
+        const std::uint64_t block_size  = read_le(in.subspan(12), 4);
+        if (!block_size) {
+            throw std::runtime_error("Broken block Huffman stream (block size). ");
+        }
+        CanonicalHuffmanCode code = HuffmanCodec::code_from_lengths(in.subspan(16, 256));
+        // no `num_of_byte + block_size - 1` => no wrap for a huge count
+        const std::uint64_t num_of_block = num_of_byte / block_size + (num_of_byte % block_size != 0);
+        if ((in.size() - HeaderSize) / 8 < num_of_block) {
+            throw std::runtime_error("Broken block Huffman stream (block index). ");
+        }
+        auto index = in.subspan(HeaderSize, 8 * num_of_block);
+        auto data  = in.subspan(HeaderSize + 8 * num_of_block);
+
+        // the header is untrusted => bound the output by the payload first
+        HuffmanDecoder decoder(std::move(code));
+        if (num_of_byte > decoder.get_max_symbols(data.size())) {
+            throw std::runtime_error("Broken block Huffman stream (too many symbols). ");
+        }
+        std::vector<std::uint8_t> res(num_of_byte);
+        Tool::parallel_for(
+            num_of_block,
+            [&](std::size_t idx) {
+                std::uint64_t beg = idx ? read_le(index.subspan(8 * (idx - 1)), 8) : 0;
+                std::uint64_t end = read_le(index.subspan(8 * idx), 8);
+                if (beg > end || end > data.size()) {
+                    throw std::runtime_error("Broken block Huffman stream (block index). ");
+                }
+                std::uint64_t first = idx * block_size;
+                decoder.decode(
+                    data.subspan(beg, end - beg),
+                    std::min<std::uint64_t>(block_size, num_of_byte - first),
+                    res.data() + first
+                );
+            },
+            num_of_thread
+        );
+        return res;
+    }
+
+private:
+    static void write_le(std::vector<std::uint8_t>& out, std::uint64_t value, int num_of_byte) {
+        for (int i = 0; i < num_of_byte; ++i) {
+            out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+    }
+    static std::uint64_t read_le(std::span<const std::uint8_t> in, int num_of_byte) {
+        std::uint64_t res = 0;
+        for (int i = num_of_byte - 1; i >= 0; --i) {
+            res = (res << 8) | in[i];
+        }
+        return res;
+    }
+};
+
+} // namespace DS
@@ -11,13 +11,18 @@
 
 #pragma once
 
+#include "CanonicalHuffman.hpp"
+
 #include <algorithm>
 #include <concepts>
+#include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <ostream>
 #include <queue>
+#include <span>
+#include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -34,6 +39,16 @@ public:
     using InitList     = std::vector<int>;
     using InitPair     = std::pair<T, int>;
     using BitCodeType  = std::vector<char>;
+    using LengthTable  = CanonicalHuffmanCode::LengthTable;
+
+    /// @brief @b build_strategy
+    /// all of them give the same tree => the lowest index wins on ties,
+    /// so leaves are picked before internal nodes of the same weight
+    enum class BuildStrategy {
+        LinearScan, // O(n^2), two scans over the table per merge
+        Heap,       // O(n log n), any input order
+        TwoQueue,   // O(n), leaves must be sorted by weight
+    };
 
 private:
     static constexpr int DebugTableWidth = 12;
@@ -45,7 +60,8 @@ private:
         int left_idx   = -1;
         int right_idx  = -1;
 
-        BitCodeType bit_code {};
+        // legacy codebook, filled on demand by `generate_bit_code`
+        mutable BitCodeType bit_code {};
 
         friend std::ostream& operator<<(std::ostream& out, const NodeInfo& self) {
             // index
@@ -77,8 +93,9 @@ private:
         }
     };
 
-    std::vector<NodeInfo>              NodeTable;
-    std::unordered_map<T, BitCodeType> BitCodeMap;
+    std::vector<NodeInfo>                      NodeTable;
+    mutable std::unordered_map<T, BitCodeType> BitCodeMap;
+    mutable bool                               if_bit_code_built = false;
 
     int num_of_initted_node = 0;
     int size_of_table       = 0;
@@ -141,45 +158,130 @@ public:
         }
         return min_idx;
     }
-    void build() {
+    void merge_into(int min_idx, int second_min_idx, int parent_idx) {
+        NodeInfo& node_min        = NodeTable[min_idx];
+        NodeInfo& node_second_min = NodeTable[second_min_idx];
+        NodeInfo& node_parent     = NodeTable[parent_idx];
+
+        node_min.parent_idx        = parent_idx;
+        node_second_min.parent_idx = parent_idx;
+
+        node_parent.weight    = node_min.weight + node_second_min.weight;
+        node_parent.left_idx  = min_idx;
+        node_parent.right_idx = second_min_idx;
+
+        ++num_of_initted_node;
+    }
+    void build_linear_scan() {
         int insert_idx = num_of_initted_node;
         while (insert_idx < size_of_table) {
             int min_idx        = get_min_without_ignored_idx();
             int second_min_idx = get_min_without_ignored_idx(min_idx);
-            int parent_idx     = insert_idx;
-
-            NodeInfo& node_min        = NodeTable[min_idx];
-            NodeInfo& node_second_min = NodeTable[second_min_idx];
-            NodeInfo& node_parent     = NodeTable[insert_idx];
-
-            node_min.parent_idx        = parent_idx;
-            node_second_min.parent_idx = parent_idx;
-
-            node_parent.weight    = node_min.weight + node_second_min.weight;
-            node_parent.left_idx  = min_idx;
-            node_parent.right_idx = second_min_idx;
-
-            ++num_of_initted_node;
+            merge_into(min_idx, second_min_idx, insert_idx);
             ++insert_idx;
         }
     }
+    void build_heap() {
+        // min heap of <weight, index> => ties broken by the lower index
+        using HeapNode = std::pair<int, int>;
+        std::vector<HeapNode> heap_data;
+        heap_data.reserve(num_of_initted_node);
+        for (int idx = 0; idx < num_of_initted_node; ++idx) {
+            heap_data.emplace_back(NodeTable[idx].weight, idx);
+        }
+        std::priority_queue<HeapNode, std::vector<HeapNode>, std::greater<>> heap(
+            std::greater<> {}, std::move(heap_data)
+        );
+        for (int insert_idx = num_of_initted_node; insert_idx < size_of_table; ++insert_idx) {
+            int min_idx = heap.top().second;
+            heap.pop();
+            int second_min_idx = heap.top().second;
+            heap.pop();
+            merge_into(min_idx, second_min_idx, insert_idx);
+            heap.emplace(NodeTable[insert_idx].weight, insert_idx);
+        }
+    }
+    void build_two_queue() {
+        // queue 1 => leaves [leaf_head, num_of_leaf), sorted by weight
+        // queue 2 => internal nodes [inner_head, insert_idx), created in
+        //            non-decreasing weight order, so it is sorted as well
+        const int num_of_leaf = num_of_initted_node;
+        int       leaf_head   = 0;
+        int       inner_head  = num_of_leaf;
+        auto      pop_min     = [&](int insert_idx) {
+            bool if_leaf = leaf_head < num_of_leaf
+                && (inner_head == insert_idx
+                    || NodeTable[leaf_head].weight <= NodeTable[inner_head].weight);
+            return if_leaf ? leaf_head++ : inner_head++;
+        };
+        for (int insert_idx = num_of_leaf; insert_idx < size_of_table; ++insert_idx) {
+            int min_idx        = pop_min(insert_idx);
+            int second_min_idx = pop_min(insert_idx);
+            merge_into(min_idx, second_min_idx, insert_idx);
+        }
+    }
+    void build(BuildStrategy strategy = BuildStrategy::TwoQueue) {
+        if (strategy == BuildStrategy::TwoQueue) {
+            auto if_sorted = std::is_sorted(
+                NodeTable.begin(), NodeTable.begin() + num_of_initted_node,
+                [](const NodeInfo& a, const NodeInfo& b) { return a.weight < b.weight; }
+            );
+            // only fall back when called on unsorted leaves directly
+            strategy = if_sorted ? BuildStrategy::TwoQueue : BuildStrategy::Heap;
+        }
+        switch (strategy) {
+            case BuildStrategy::LinearScan: build_linear_scan(); break;
+            case BuildStrategy::Heap: build_heap(); break;
+            case BuildStrategy::TwoQueue: build_two_queue(); break;
+        }
+    }
+
+    /// @brief @b init_from_counts (integral symbols, `counts[symbol]`)
+    /// feeds the output of `SymbolHistogram` straight into `Generate`,
+    /// weights are scaled down (never to 0) when their sum overflows int
+    static InitPairList init_from_counts(std::span<const std::uint64_t> counts)
+    requires std::integral<T>
+    {
+        std::uint64_t total = 0;
+        for (std::uint64_t count : counts) {
+            total += count;
+        }
+        int shift = 0;
+        while ((total >> shift) + counts.size() > static_cast<std::uint64_t>(INT32_MAX)) {
+            ++shift;
+        }
+        InitPairList res;
+        for (std::size_t symbol = 0; symbol < counts.size(); ++symbol) {
+            if (counts[symbol]) {
+                auto weight = std::max<std::uint64_t>(counts[symbol] >> shift, 1);
+                res.emplace_back(static_cast<T>(symbol), static_cast<int>(weight));
+            }
+        }
+        return res;
+    }
 
     /// @brief @b TreeGenerator
-    void Generate(InitPairList& init) {
+    void Generate(InitPairList& init, BuildStrategy strategy = BuildStrategy::TwoQueue) {
+        unique(init);
+        // count after `unique`, duplicates must not become phantom leaves
         num_of_input_node   = init.size();
         num_of_initted_node = init.size();
-        unique(init);
+        NodeTable.clear();
+        BitCodeMap.clear();
+        if_bit_code_built = false;
+        size_of_table     = 0;
+        if (init.empty()) {
+            return;
+        }
         sort(init);
         alloc(init);
         preBuild(init);
-        build();
-        generate_bit_code();
-        build_bit_code_map();
+        build(strategy);
     }
 
     /// @brief @b constructors
-    explicit HuffmanTree(InitPairList& init) {
-        Generate(init);
+    explicit HuffmanTree(InitPairList& init, BuildStrategy strategy = BuildStrategy::TwoQueue) {
+        Generate(init, strategy);
     }
 
     /// @brief @b View_the_table
@@ -202,6 +304,7 @@ public:
 
     /// @brief @b View_the_CodeBitSet
     void EchoBitCode() {
+        build_bit_code_map();
         for (int idx = 0; idx < num_of_input_node; ++idx) {
             const NodeInfo& curr_node = NodeTable[idx];
             std::cout << curr_node.value;
@@ -215,10 +318,11 @@ public:
     }
 
     /// @brief @b bit_code_generator
-    int  get_root_idx() { return NodeTable.back().index; }
-    int  get_left_idx(const int& in) { return NodeTable[in].left_idx; }
-    int  get_right_idx(const int& in) { return NodeTable[in].right_idx; }
-    void generate_bit_code() {
+    /// only for the legacy codebook => `get_canonical_code` never runs it
+    int  get_root_idx() const { return NodeTable.back().index; }
+    int  get_left_idx(const int& in) const { return NodeTable[in].left_idx; }
+    int  get_right_idx(const int& in) const { return NodeTable[in].right_idx; }
+    void generate_bit_code() const {
         if (!size_of_table) {
             return;
         }
@@ -232,17 +336,17 @@ public:
                 int left_idx  = get_left_idx(curr_idx);
                 int right_idx = get_right_idx(curr_idx);
 
-                NodeInfo& curr  = NodeTable[curr_idx];
-                NodeInfo& left  = NodeTable[left_idx];
-                NodeInfo& right = NodeTable[right_idx];
+                const NodeInfo& curr = NodeTable[curr_idx];
 
                 if (left_idx != -1) {
-                    left.bit_code = curr.bit_code;
+                    const NodeInfo& left = NodeTable[left_idx];
+                    left.bit_code        = curr.bit_code;
                     left.bit_code.push_back(0);
                     queue.push(left_idx);
                 }
                 if (right_idx != -1) {
-                    right.bit_code = curr.bit_code;
+                    const NodeInfo& right = NodeTable[right_idx];
+                    right.bit_code        = curr.bit_code;
                     right.bit_code.push_back(1);
                     queue.push(right_idx);
                 }
@@ -251,7 +355,13 @@ public:
             }
         }
     }
-    void build_bit_code_map() {
+    /// @brief built once, on the first `get_bitcode_map` / `EchoBitCode`
+    void build_bit_code_map() const {
+        if (if_bit_code_built) {
+            return;
+        }
+        if_bit_code_built = true;
+        generate_bit_code();
         for (int idx = 0; idx < num_of_input_node; ++idx) {
             const NodeInfo&    curr          = NodeTable[idx];
             const T&           curr_value    = curr.value;
@@ -259,9 +369,82 @@ public:
             BitCodeMap.insert(std::make_pair(curr_value, curr_bit_code));
         }
     }
-    auto get_bitcode_map() -> decltype(BitCodeMap) {
+    auto get_bitcode_map() const -> const decltype(BitCodeMap)& {
+        build_bit_code_map();
         return BitCodeMap;
     }
+
+    /// @brief @b canonical_code (integral symbols only)
+    /// symbols are used as indexes of a dense table => for 1-byte types
+    /// it is the unsigned byte, wider types must be non-negative
+    static std::size_t symbol_index(const T& symbol)
+    requires std::integral<T>
+    {
+        if constexpr (sizeof(T) == 1) {
+            return static_cast<std::uint8_t>(symbol);
+        } else {
+            if constexpr (std::is_signed_v<T>) {
+                if (symbol < 0) {
+                    throw std::out_of_range("Negative symbol has no canonical code!");
+                }
+            }
+            return static_cast<std::size_t>(symbol);
+        }
+    }
+    std::size_t get_alphabet_size() const
+    requires std::integral<T>
+    {
+        std::size_t res = 0;
+        for (int idx = 0; idx < num_of_input_node; ++idx) {
+            res = std::max(res, symbol_index(NodeTable[idx].value) + 1);
+        }
+        return res;
+    }
+    /// @brief depth of every node, read from the parent links (no bit codes)
+    std::vector<int> get_depth_table() const {
+        // parents always come after their children in the table
+        std::vector<int> depth(size_of_table, 0);
+        for (int idx = size_of_table - 2; idx >= 0; --idx) {
+            depth[idx] = depth[NodeTable[idx].parent_idx] + 1;
+        }
+        return depth;
+    }
+    LengthTable get_code_lengths() const
+    requires std::integral<T>
+    {
+        LengthTable res(get_alphabet_size(), 0);
+        if (num_of_input_node == 1) {
+            res[symbol_index(NodeTable[0].value)] = 1; // a lone symbol still needs one bit
+            return res;
+        }
+        std::vector<int> depth = get_depth_table();
+        for (int idx = 0; idx < num_of_input_node; ++idx) {
+            if (depth[idx] > CanonicalHuffmanCode::MaxCodeLength) {
+                throw std::length_error("Huffman code is longer than 64 bits, limit its length!");
+            }
+            res[symbol_index(NodeTable[idx].value)] = static_cast<std::uint8_t>(depth[idx]);
+        }
+        return res;
+    }
+    /// @brief lengths longer than `max_length` => recomputed by package-merge
+    CanonicalHuffmanCode get_canonical_code(int max_length = CanonicalHuffmanCode::MaxCodeLength) const
+    requires std::integral<T>
+    {
+        std::vector<int> depth   = get_depth_table();
+        int              deepest = depth.empty() ? 0 : *std::max_element(depth.begin(), depth.end());
+        if (deepest <= max_length) {
+            return CanonicalHuffmanCode::FromLengths(get_code_lengths());
+        }
+        std::vector<std::uint64_t> weights(get_alphabet_size(), 0);
+        for (int idx = 0; idx < num_of_input_node; ++idx) {
+            // weight 0 would mean `unused` to package-merge
+            weights[symbol_index(NodeTable[idx].value)]
+                = std::max<std::uint64_t>(NodeTable[idx].weight, 1);
+        }
+        return CanonicalHuffmanCode::FromLengths(
+            CanonicalHuffmanCode::LimitedLengths(weights, max_length)
+        );
+    }
 };
 
 } // namespace DS
\ No newline at end of file
@@ -0,0 +1,206 @@
+/**
+ * @file ImplicitBinaryTree.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Complete BinaryTree embedded in a flat array (no pointers)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "BinaryTree.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b ImplicitBinaryTree
+/// node `i` has children `2i + 1` and `2i + 2`, parent `(i - 1) / 2`,
+/// so the array is exactly the level order of a complete tree
+template <typename T>
+class ImplicitBinaryTree {
+public:
+    using ElemType = T;
+    using Index    = std::size_t;
+
+private:
+    std::vector<T> Data;
+
+    static constexpr Index left_of(Index idx) { return 2 * idx + 1; }
+    static constexpr Index right_of(Index idx) { return 2 * idx + 2; }
+
+    void make_sure_valid(Index idx) const {
+        if (idx >= Data.size()) {
+            throw std::out_of_range("Input node is out of the tree. ");
+        }
+    }
+    /// @brief left most node of the sub tree => first one in in-order
+    Index left_most(Index idx) const {
+        while (left_of(idx) < Data.size()) {
+            idx = left_of(idx);
+        }
+        return idx;
+    }
+
+public:
+    /// @brief @b constructor
+    ImplicitBinaryTree() = default;
+    explicit ImplicitBinaryTree(std::vector<T> level_order)
+        : Data(std::move(level_order)) { }
+
+    /// @brief @b conversion_from_complete_BinaryTree
+    static ImplicitBinaryTree FromBinaryTree(BinaryTree<T>& tree) {
+        if (!tree.IfCompleteBiTree_Parallel()) {
+            throw std::logic_error("Only a complete BinaryTree could be embedded!");
+        }
+        std::vector<T> level_order;
+        level_order.reserve(tree.BiTreeSize());
+        tree.LevelOrderOpt([&](auto* node) { level_order.push_back(tree.Value(node)); });
+        return ImplicitBinaryTree(std::move(level_order));
+    }
+
+    /// @brief @b eytzinger_layout (in-order of the tree == sorted order)
+    template <std::ranges::input_range Range>
+    requires std::totally_ordered<T>
+    static ImplicitBinaryTree FromSorted(Range&& sorted) {
+        std::vector<T> elems(std::ranges::begin(sorted), std::ranges::end(sorted));
+        if (!std::ranges::is_sorted(elems)) {
+            throw std::logic_error("Input of FromSorted is not sorted!");
+        }
+        ImplicitBinaryTree res;
+        res.Data.resize(elems.size());
+        auto pos = elems.begin();
+        res.InOrderOpt([&](Index idx) { res.Data[idx] = std::move(*pos++); });
+        return res;
+    }
+
+    /// @brief @b size_related
+    bool  BiTreeEmpty() const { return Data.empty(); }
+    Index BiTreeSize() const { return Data.size(); }
+    int   BiTreeDepth() const { return static_cast<int>(std::bit_width(Data.size())); }
+
+    /// @brief @b Node_Relation_Opt (`npos` for NULL)
+    static constexpr Index npos = static_cast<Index>(-1);
+
+    Index Root() const { return Data.empty() ? npos : 0; }
+    T&    Value(Index idx) {
+        make_sure_valid(idx);
+        return Data[idx];
+    }
+    const T& Value(Index idx) const {
+        make_sure_valid(idx);
+        return Data[idx];
+    }
+    Index LeftChild(Index idx) const {
+        make_sure_valid(idx);
+        return left_of(idx) < Data.size() ? left_of(idx) : npos;
+    }
+    Index RightChild(Index idx) const {
+        make_sure_valid(idx);
+        return right_of(idx) < Data.size() ? right_of(idx) : npos;
+    }
+    Index Parent(Index idx) const {
+        make_sure_valid(idx);
+        return idx == 0 ? npos : (idx - 1) / 2;
+    }
+    const std::vector<T>& LevelOrderData() const { return Data; }
+
+    /// @brief @b Traverse_Engine => func(Index), no stack needed
+    template <typename Func>
+    void LevelOrderOpt(Func&& func) const {
+        for (Index idx = 0; idx < Data.size(); ++idx) {
+            func(idx);
+        }
+    }
+    template <typename Func>
+    void InOrderOpt(Func&& func) const {
+        if (Data.empty()) {
+            return;
+        }
+        Index idx = left_most(0);
+        while (true) {
+            func(idx);
+            if (right_of(idx) < Data.size()) {
+                idx = left_most(right_of(idx));
+                continue;
+            }
+            // climb while being a right child, then one more step
+            while (idx != 0 && idx % 2 == 0) {
+                idx = (idx - 1) / 2;
+            }
+            if (idx == 0) {
+                return;
+            }
+            idx = (idx - 1) / 2;
+        }
+    }
+    template <typename Func>
+    void PreOrderOpt(Func&& func) const {
+        std::vector<Index> opt_stack;
+        if (!Data.empty()) {
+            opt_stack.push_back(0);
+        }
+        while (!opt_stack.empty()) {
+            Index idx = opt_stack.back();
+            opt_stack.pop_back();
+            func(idx);
+            if (right_of(idx) < Data.size()) {
+                opt_stack.push_back(right_of(idx));
+            }
+            if (left_of(idx) < Data.size()) {
+                opt_stack.push_back(left_of(idx));
+            }
+        }
+    }
+
+    /// @brief @b Traverse
+    void LevelOrderTraverse() const {
+        LevelOrderOpt([this](Index idx) { std::cout << Data[idx] << " "; });
+    }
+    void InOrderTraverse() const {
+        InOrderOpt([this](Index idx) { std::cout << Data[idx] << " "; });
+    }
+    void PreOrderTraverse() const {
+        PreOrderOpt([this](Index idx) { std::cout << Data[idx] << " "; });
+    }
+
+    /// @brief @b eytzinger_search (only meaningful after `FromSorted`)
+    /// branch free descent, the 16 great-grandchildren of the current
+    /// node share one or two cache lines and are prefetched ahead
+    Index LowerBound(const T& value) const
+    requires std::totally_ordered<T>
+    {
+        const Index num = Data.size();
+        Index       k   = 1; // 1-based => children at 2k, 2k + 1
+        while (k <= num) {
+#if defined(__GNUC__) || defined(__clang__)
+            if (16 * k <= num) {
+                __builtin_prefetch(Data.data() + 16 * k - 1);
+            }
+#endif
+            k = 2 * k + static_cast<Index>(Data[k - 1] < value);
+        }
+        // drop the trailing right turns and the last left turn
+        k >>= std::countr_one(k) + 1;
+        return k == 0 ? npos : k - 1;
+    }
+    bool Contains(const T& value) const
+    requires std::totally_ordered<T>
+    {
+        Index idx = LowerBound(value);
+        return idx != npos && !(value < Data[idx]);
+    }
+};
+
+} // namespace DS
@@ -0,0 +1,273 @@
+/**
+ * @file BlockMatrix.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Block compressed sparse row (BSR) matrix with SIMD block kernels
+ * @structure: (BlockRow = BlockCol = 2)
+        Ptr       => [0, 2, 3]                block row `r` owns [Ptr[r], Ptr[r + 1])
+        BlockCols => [0, 2, 1]                block col of each stored block
+        Blocks    => [a c b d | ... | ...]    dense blocks, each column major
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../../tools/Parallel.hpp"
+#include "CompressedMatrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace DS {
+
+/// @brief @b BlockMatrix (BSR, 0-based)
+/// one index per `BlockRow x BlockCol` dense block instead of one per
+/// non-zero, and the SpMV works on whole blocks: with the block stored
+/// column major, column `c` times x[c] is a few vertical SIMD multiply-adds
+/// into accumulators that stay in registers along the whole block row.
+/// the block size is a template parameter => every block loop is unrolled
+template <typename T, std::size_t BlockRow, std::size_t BlockCol = BlockRow, typename Index = int>
+class BlockMatrix {
+    static_assert(BlockRow > 0 && BlockCol > 0, "Empty blocks are not allowed");
+    static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+
+public:
+    static constexpr std::size_t BlockSize = BlockRow * BlockCol;
+
+private:
+    std::size_t num_of_block_row = 0;
+    std::size_t num_of_block_col = 0;
+
+    std::vector<std::size_t> Ptr = { 0 };
+    std::vector<Index>       BlockCols;
+    std::vector<T>           Blocks; // BlockSize per stored block
+
+    /// @brief func(std::integral_constant<std::size_t, I>) for I in [0, N)
+    template <typename Func, std::size_t... Is>
+    static void unroll(Func&& func, std::index_sequence<Is...>) {
+        (func(std::integral_constant<std::size_t, Is> {}), ...);
+    }
+
+    /// @brief @b block_row_kernel => y[0, BlockRow) = block row * x
+    static void block_row_kernel(
+        const T*     blocks,
+        const Index* block_cols,
+        std::size_t  beg,
+        std::size_t  end,
+        const T*     x,
+        T*           y
+    ) {
+#if defined(__AVX__)
+        if constexpr (std::is_same_v<T, double> && BlockRow % 4 == 0) {
+            constexpr std::size_t Lanes = BlockRow / 4;
+            __m256d               acc[Lanes];
+            unroll([&](auto lane) { acc[lane] = _mm256_setzero_pd(); }, std::make_index_sequence<Lanes> {});
+            for (std::size_t pos = beg; pos < end; ++pos) {
+                const double* block = blocks + pos * BlockSize;
+                const double* xs    = x + static_cast<std::size_t>(block_cols[pos]) * BlockCol;
+                unroll(
+                    [&](auto col) {
+                        __m256d x_col = _mm256_set1_pd(xs[col]);
+                        unroll(
+                            [&](auto lane) {
+                                __m256d a = _mm256_loadu_pd(block + col * BlockRow + 4 * lane);
+#if defined(__FMA__)
+                                acc[lane] = _mm256_fmadd_pd(a, x_col, acc[lane]);
+#else
+                                acc[lane] = _mm256_add_pd(acc[lane], _mm256_mul_pd(a, x_col));
+#endif
+                            },
+                            std::make_index_sequence<Lanes> {}
+                        );
+                    },
+                    std::make_index_sequence<BlockCol> {}
+                );
+            }
+            unroll([&](auto lane) { _mm256_storeu_pd(y + 4 * lane, acc[lane]); }, std::make_index_sequence<Lanes> {});
+            return;
+        }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+        if constexpr (std::is_same_v<T, double> && BlockRow % 2 == 0) {
+            constexpr std::size_t Lanes = BlockRow / 2;
+            __m128d               acc[Lanes];
+            unroll([&](auto lane) { acc[lane] = _mm_setzero_pd(); }, std::make_index_sequence<Lanes> {});
+            for (std::size_t pos = beg; pos < end; ++pos) {
+                const double* block = blocks + pos * BlockSize;
+                const double* xs    = x + static_cast<std::size_t>(block_cols[pos]) * BlockCol;
+                unroll(
+                    [&](auto col) {
+                        __m128d x_col = _mm_set1_pd(xs[col]);
+                        unroll(
+                            [&](auto lane) {
+                                __m128d a = _mm_loadu_pd(block + col * BlockRow + 2 * lane);
+                                acc[lane] = _mm_add_pd(acc[lane], _mm_mul_pd(a, x_col));
+                            },
+                            std::make_index_sequence<Lanes> {}
+                        );
+                    },
+                    std::make_index_sequence<BlockCol> {}
+                );
+            }
+            unroll([&](auto lane) { _mm_storeu_pd(y + 2 * lane, acc[lane]); }, std::make_index_sequence<Lanes> {});
+            return;
+        }
+#endif
+        T acc[BlockRow] = {};
+        for (std::size_t pos = beg; pos < end; ++pos) {
+            const T* block = blocks + pos * BlockSize;
+            const T* xs    = x + static_cast<std::size_t>(block_cols[pos]) * BlockCol;
+            unroll(
+                [&](auto col) {
+                    unroll(
+                        [&](auto row) { acc[row] += block[col * BlockRow + row] * xs[col]; },
+                        std::make_index_sequence<BlockRow> {}
+                    );
+                },
+                std::make_index_sequence<BlockCol> {}
+            );
+        }
+        std::copy(acc, acc + BlockRow, y);
+    }
+
+public:
+    /// @brief @b constructor => empty `0 x 0` matrix
+    BlockMatrix() = default;
+
+    /// @brief @b FromCSR, every block touched by a non-zero is stored whole;
+    /// the sizes of the matrix must be multiples of the block sizes
+    template <typename CSRIndex>
+    static BlockMatrix FromCSR(const CSRMatrix<T, CSRIndex>& csr) {
+        if (csr.get_num_of_row() % BlockRow || csr.get_num_of_col() % BlockCol) {
+            throw std::invalid_argument("Matrix size is not a multiple of the block size!");
+        }
+        BlockMatrix res;
+        res.num_of_block_row = csr.get_num_of_row() / BlockRow;
+        res.num_of_block_col = csr.get_num_of_col() / BlockCol;
+        res.Ptr.assign(res.num_of_block_row + 1, 0);
+
+        auto row_ptr   = csr.get_ptr();
+        auto col_index = csr.get_indexes();
+        auto values    = csr.get_values();
+
+        // slot_of[block col] => position of the block in the current block row
+        constexpr std::size_t    Null = static_cast<std::size_t>(-1);
+        std::vector<std::size_t> slot_of(res.num_of_block_col, Null);
+        std::vector<Index>       row_block_cols;
+        for (std::size_t block_row = 0; block_row < res.num_of_block_row; ++block_row) {
+            const std::size_t first_row = block_row * BlockRow;
+            row_block_cols.clear();
+            for (std::size_t pos = row_ptr[first_row]; pos < row_ptr[first_row + BlockRow]; ++pos) {
+                std::size_t block_col = static_cast<std::size_t>(col_index[pos]) / BlockCol;
+                if (slot_of[block_col] == Null) {
+                    slot_of[block_col] = 0;
+                    row_block_cols.push_back(static_cast<Index>(block_col));
+                }
+            }
+            std::sort(row_block_cols.begin(), row_block_cols.end());
+
+            const std::size_t base = res.BlockCols.size();
+            for (std::size_t slot = 0; slot < row_block_cols.size(); ++slot) {
+                slot_of[static_cast<std::size_t>(row_block_cols[slot])] = base + slot;
+            }
+            res.BlockCols.insert(res.BlockCols.end(), row_block_cols.begin(), row_block_cols.end());
+            res.Blocks.resize(res.BlockCols.size() * BlockSize, T {});
+            for (std::size_t row = 0; row < BlockRow; ++row) {
+                for (std::size_t pos = row_ptr[first_row + row]; pos < row_ptr[first_row + row + 1]; ++pos) {
+                    std::size_t col   = static_cast<std::size_t>(col_index[pos]);
+                    std::size_t block = slot_of[col / BlockCol];
+                    res.Blocks[block * BlockSize + (col % BlockCol) * BlockRow + row] += values[pos];
+                }
+            }
+            for (Index block_col : row_block_cols) {
+                slot_of[static_cast<std::size_t>(block_col)] = Null;
+            }
+            res.Ptr[block_row + 1] = res.BlockCols.size();
+        }
+        return res;
+    }
+
+    /// @brief @b to_csr, zeros inside the stored blocks are dropped
+    template <typename CSRIndex = Index>
+    CSRMatrix<T, CSRIndex> to_csr() const {
+        std::vector<std::size_t> row_ptr = { 0 };
+        std::vector<CSRIndex>    col_index;
+        std::vector<T>           values;
+        for (std::size_t block_row = 0; block_row < num_of_block_row; ++block_row) {
+            for (std::size_t row = 0; row < BlockRow; ++row) {
+                for (std::size_t pos = Ptr[block_row]; pos < Ptr[block_row + 1]; ++pos) {
+                    for (std::size_t col = 0; col < BlockCol; ++col) {
+                        const T& value = Blocks[pos * BlockSize + col * BlockRow + row];
+                        if (value != T {}) {
+                            col_index.push_back(static_cast<CSRIndex>(static_cast<std::size_t>(BlockCols[pos]) * BlockCol + col));
+                            values.push_back(value);
+                        }
+                    }
+                }
+                row_ptr.push_back(col_index.size());
+            }
+        }
+        return { get_num_of_row(), get_num_of_col(), std::move(row_ptr), std::move(col_index), std::move(values) };
+    }
+
+    /// @brief @b getters
+    std::size_t get_num_of_row() const { return num_of_block_row * BlockRow; }
+    std::size_t get_num_of_col() const { return num_of_block_col * BlockCol; }
+    std::size_t get_num_of_block() const { return BlockCols.size(); }
+
+    /// @brief @b fill_ratio => stored non-zeros / stored values
+    double fill_ratio() const {
+        if (Blocks.empty()) {
+            return 1.0;
+        }
+        auto num_of_nonzero = std::count_if(Blocks.begin(), Blocks.end(), [](const T& value) { return value != T {}; });
+        return static_cast<double>(num_of_nonzero) / static_cast<double>(Blocks.size());
+    }
+
+    /// @brief @b multiply => y = A * x, block rows split over the threads
+    /// by number of blocks
+    void multiply(std::span<const T> x, std::span<T> y, unsigned num_of_thread = 1) const {
+        if (x.size() != get_num_of_col() || y.size() != get_num_of_row()) {
+            throw std::invalid_argument("Vector size does not match the matrix!");
+        }
+        num_of_thread = static_cast<unsigned>(std::clamp<std::size_t>(num_of_block_row, 1, std::max(1u, num_of_thread)));
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            auto bound = [&](unsigned part) -> std::size_t {
+                if (part == num_of_thread) {
+                    return num_of_block_row;
+                }
+                std::size_t target = get_num_of_block() * part / num_of_thread;
+                return static_cast<std::size_t>(std::lower_bound(Ptr.begin(), Ptr.end() - 1, target) - Ptr.begin());
+            };
+            for (std::size_t block_row = bound(worker_id); block_row < bound(worker_id + 1); ++block_row) {
+                block_row_kernel(
+                    Blocks.data(), BlockCols.data(), Ptr[block_row], Ptr[block_row + 1], x.data(), y.data() + block_row * BlockRow
+                );
+            }
+        });
+    }
+    std::vector<T> operator*(const std::vector<T>& x) const {
+        std::vector<T> y(get_num_of_row());
+        multiply(x, y, Tool::num_of_worker());
+        return y;
+    }
+};
+
+template <typename T, std::size_t BlockSize, typename Index = int>
+using BSRMatrix = BlockMatrix<T, BlockSize, BlockSize, Index>;
+
+} // namespace DS
@@ -0,0 +1,391 @@
+/**
+ * @file CompressedMatrix.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Compressed sparse row / column (CSR / CSC) matrices and SpMV
+ * @structure: (CSR, the CSC one is the same with rows and cols swapped)
+        Ptr    => [0, 2, 3, 5]          row `r` owns [Ptr[r], Ptr[r + 1])
+        Index  => [1, 3, 0, 2, 3]       col of each non-zero, ascending per row
+        Values => [a, b, c, d, e]
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../../tools/Parallel.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace DS {
+
+/// @brief @b CompressedMatrix
+/// `IfRowMajor` => CSR (outer = row, inner = col), otherwise CSC.
+/// `Index` is the type of the inner indexes (int => 4 bytes per non-zero
+/// and usable by hardware gathers), offsets are always `std::size_t`.
+/// indexes start from 0, unlike `SparseMatrix`.
+template <typename T, typename Index = int, bool IfRowMajor = true>
+class CompressedMatrix {
+    static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+
+public:
+    using ValueType = T;
+    using IndexType = Index;
+
+    static constexpr bool RowMajor = IfRowMajor;
+
+private:
+    std::size_t num_of_row = 0;
+    std::size_t num_of_col = 0;
+
+    std::vector<std::size_t> Ptr = { 0 };
+    std::vector<Index>       Indexes;
+    std::vector<T>           Values;
+
+    std::size_t outer_size() const { return IfRowMajor ? num_of_row : num_of_col; }
+    std::size_t inner_size() const { return IfRowMajor ? num_of_col : num_of_row; }
+
+    /// @brief @b dot_of_one_outer (gather side of the SpMV)
+    static T gather_dot(const T* values, const Index* indexes, std::size_t beg, std::size_t end, const T* x) {
+        T           sum = T {};
+        std::size_t pos = beg;
+#if defined(__AVX2__)
+        if constexpr (std::is_same_v<T, double> && sizeof(Index) == 4) {
+            __m256d acc = _mm256_setzero_pd();
+            for (; pos + 4 <= end; pos += 4) {
+                __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indexes + pos));
+                __m256d xs  = _mm256_i32gather_pd(x, idx, 8);
+                acc         = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(values + pos), xs));
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, acc);
+            sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        } else if constexpr (std::is_same_v<T, float> && sizeof(Index) == 4) {
+            __m256 acc = _mm256_setzero_ps();
+            for (; pos + 8 <= end; pos += 8) {
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indexes + pos));
+                __m256  xs  = _mm256_i32gather_ps(x, idx, 4);
+                acc         = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(values + pos), xs));
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, acc);
+            for (float lane : lanes) {
+                sum += lane;
+            }
+        }
+#endif
+        for (; pos < end; ++pos) {
+            sum += values[pos] * x[indexes[pos]];
+        }
+        return sum;
+    }
+
+    /// @brief outer range of worker `worker_id`, balanced by non-zeros
+    /// rather than by rows, so a few heavy rows do not serialize the work
+    std::pair<std::size_t, std::size_t> outer_range(unsigned worker_id, unsigned num_of_thread) const {
+        auto bound = [&](unsigned part) -> std::size_t {
+            if (part == 0) {
+                return 0;
+            }
+            if (part == num_of_thread) {
+                return outer_size();
+            }
+            std::size_t target = get_nnz() * part / num_of_thread;
+            return static_cast<std::size_t>(
+                std::lower_bound(Ptr.begin(), Ptr.end() - 1, target) - Ptr.begin()
+            );
+        };
+        return { bound(worker_id), bound(worker_id + 1) };
+    }
+    unsigned clamp_thread(unsigned num_of_thread) const {
+        return static_cast<unsigned>(std::clamp<std::size_t>(outer_size(), 1, std::max(1u, num_of_thread)));
+    }
+
+    /// @brief y[outer] = sum of (value * x[inner])
+    void gather_multiply(std::span<const T> x, std::span<T> y, unsigned num_of_thread) const {
+        num_of_thread = clamp_thread(num_of_thread);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            auto [beg, end] = outer_range(worker_id, num_of_thread);
+            for (std::size_t outer = beg; outer < end; ++outer) {
+                y[outer] = gather_dot(Values.data(), Indexes.data(), Ptr[outer], Ptr[outer + 1], x.data());
+            }
+        });
+    }
+    /// @brief y[inner] += value * x[outer], per-thread partial results
+    /// (the writes collide across outers), summed in parallel at the end
+    void scatter_multiply(std::span<const T> x, std::span<T> y, unsigned num_of_thread) const {
+        num_of_thread = clamp_thread(num_of_thread);
+        std::fill(y.begin(), y.end(), T {});
+        if (num_of_thread == 1) {
+            for (std::size_t outer = 0; outer < outer_size(); ++outer) {
+                for (std::size_t pos = Ptr[outer]; pos < Ptr[outer + 1]; ++pos) {
+                    y[Indexes[pos]] += Values[pos] * x[outer];
+                }
+            }
+            return;
+        }
+        std::vector<std::vector<T>> partial(num_of_thread);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<T>& part = partial[worker_id];
+            part.assign(y.size(), T {});
+            auto [beg, end] = outer_range(worker_id, num_of_thread);
+            for (std::size_t outer = beg; outer < end; ++outer) {
+                for (std::size_t pos = Ptr[outer]; pos < Ptr[outer + 1]; ++pos) {
+                    part[Indexes[pos]] += Values[pos] * x[outer];
+                }
+            }
+        });
+        Tool::parallel_for_range(
+            y.size(),
+            [&](unsigned, std::size_t beg, std::size_t end) {
+                for (const std::vector<T>& part : partial) {
+                    for (std::size_t idx = beg; idx < end; ++idx) {
+                        y[idx] += part[idx];
+                    }
+                }
+            },
+            num_of_thread
+        );
+    }
+
+    void check_vector_size(std::size_t x_size, std::size_t y_size, bool if_transposed) const {
+        std::size_t need_x = if_transposed ? num_of_row : num_of_col;
+        std::size_t need_y = if_transposed ? num_of_col : num_of_row;
+        if (x_size != need_x || y_size != need_y) {
+            throw std::invalid_argument("Vector size does not match the matrix!");
+        }
+    }
+
+public:
+    /// @brief @b constructor => empty `0 x 0` matrix
+    CompressedMatrix() = default;
+
+    /// @brief @b constructor from the raw arrays, which are validated:
+    /// `ptr` => outer_size + 1 non-decreasing offsets from 0 to nnz,
+    /// `indexes` and `values` => nnz items, indexes inside the matrix
+    CompressedMatrix(
+        std::size_t              num_of_row,
+        std::size_t              num_of_col,
+        std::vector<std::size_t> ptr,
+        std::vector<Index>       indexes,
+        std::vector<T>           values
+    )
+        : num_of_row(num_of_row)
+        , num_of_col(num_of_col)
+        , Ptr(std::move(ptr))
+        , Indexes(std::move(indexes))
+        , Values(std::move(values)) {
+        if (Ptr.size() != outer_size() + 1 || Ptr.front() != 0 || Ptr.back() != Indexes.size()
+            || Indexes.size() != Values.size()) {
+            throw std::invalid_argument("Inconsistent compressed matrix arrays!");
+        }
+        if (!std::is_sorted(Ptr.begin(), Ptr.end())) {
+            throw std::invalid_argument("Compressed matrix offsets must not decrease!");
+        }
+        for (Index idx : Indexes) {
+            if (std::cmp_less(idx, 0) || std::cmp_greater_equal(idx, inner_size())) {
+                throw std::out_of_range("Compressed matrix index is out of range!");
+            }
+        }
+    }
+
+    /// @brief @b getters
+    std::size_t get_num_of_row() const { return num_of_row; }
+    std::size_t get_num_of_col() const { return num_of_col; }
+    std::size_t get_nnz() const { return Indexes.size(); }
+
+    std::span<const std::size_t> get_ptr() const { return Ptr; }
+    std::span<const Index>       get_indexes() const { return Indexes; }
+    std::span<const T>           get_values() const { return Values; }
+
+    /// @brief @b at (0-based), zero when the entry is not stored
+    T at(std::size_t row, std::size_t col) const {
+        if (row >= num_of_row || col >= num_of_col) {
+            throw std::out_of_range("Matrix index is out of range!");
+        }
+        std::size_t outer = IfRowMajor ? row : col;
+        auto        inner = static_cast<Index>(IfRowMajor ? col : row);
+        auto        beg   = Indexes.begin() + Ptr[outer];
+        auto        end   = Indexes.begin() + Ptr[outer + 1];
+        auto        iter  = std::lower_bound(beg, end, inner);
+        return (iter != end && *iter == inner) ? Values[iter - Indexes.begin()] : T {};
+    }
+
+    /// @brief @b multiply => y = A * x
+    /// CSR gathers x along each row (rows split over the threads),
+    /// CSC scatters into y (per-thread partial y, then a parallel sum)
+    void multiply(std::span<const T> x, std::span<T> y, unsigned num_of_thread = 1) const {
+        check_vector_size(x.size(), y.size(), false);
+        if constexpr (IfRowMajor) {
+            gather_multiply(x, y, num_of_thread);
+        } else {
+            scatter_multiply(x, y, num_of_thread);
+        }
+    }
+    /// @brief @b multiply_transposed => y = A^T * x, without building A^T
+    void multiply_transposed(std::span<const T> x, std::span<T> y, unsigned num_of_thread = 1) const {
+        check_vector_size(x.size(), y.size(), true);
+        if constexpr (IfRowMajor) {
+            scatter_multiply(x, y, num_of_thread);
+        } else {
+            gather_multiply(x, y, num_of_thread);
+        }
+    }
+    std::vector<T> operator*(const std::vector<T>& x) const {
+        std::vector<T> y(num_of_row);
+        multiply(x, y, Tool::num_of_worker());
+        return y;
+    }
+
+    /// @brief @b convert between CSR and CSC (counting sort by inner index)
+    /// every thread counts the inner indexes of its own outer range, the
+    /// counts are prefix-summed in (inner, thread) order and every thread
+    /// scatters its range to its own offsets => no atomics, and the new
+    /// inner indexes stay ascending exactly as with one thread
+    CompressedMatrix<T, Index, !IfRowMajor> convert(unsigned num_of_thread = 1) const {
+        num_of_thread = clamp_thread(num_of_thread);
+        const std::size_t num_of_bucket = inner_size();
+
+        std::vector<std::vector<std::size_t>> offsets(num_of_thread);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& count = offsets[worker_id];
+            count.assign(num_of_bucket, 0);
+            auto [beg, end] = outer_range(worker_id, num_of_thread);
+            for (std::size_t pos = Ptr[beg]; pos < Ptr[end]; ++pos) {
+                ++count[Indexes[pos]];
+            }
+        });
+        std::vector<std::size_t> ptr(num_of_bucket + 1, 0);
+        for (std::size_t inner = 0; inner < num_of_bucket; ++inner) {
+            std::size_t sum = ptr[inner];
+            for (std::vector<std::size_t>& count : offsets) {
+                std::size_t curr = count[inner];
+                count[inner]     = sum;
+                sum              += curr;
+            }
+            ptr[inner + 1] = sum;
+        }
+
+        std::vector<Index> indexes(get_nnz());
+        std::vector<T>     values(get_nnz());
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& next = offsets[worker_id];
+            auto [beg, end]                = outer_range(worker_id, num_of_thread);
+            for (std::size_t outer = beg; outer < end; ++outer) {
+                for (std::size_t pos = Ptr[outer]; pos < Ptr[outer + 1]; ++pos) {
+                    std::size_t dest = next[Indexes[pos]]++;
+                    indexes[dest]    = static_cast<Index>(outer);
+                    values[dest]     = Values[pos];
+                }
+            }
+        });
+        return { num_of_row, num_of_col, std::move(ptr), std::move(indexes), std::move(values) };
+    }
+
+    static constexpr int RadixLowBits = 12;
+
+    /// @brief @b convert_radix, two stable passes on the inner index:
+    /// high bits first (few buckets => every scatter stream stays in cache),
+    /// then each high bucket is counting-sorted on its `RadixLowBits` low
+    /// bits with an L1-sized table, one bucket per task.
+    /// beats `convert` once the inner dimension outgrows the cache
+    CompressedMatrix<T, Index, !IfRowMajor> convert_radix(unsigned num_of_thread = 1) const {
+        num_of_thread = clamp_thread(num_of_thread);
+        const std::size_t low_size      = std::size_t { 1 } << RadixLowBits;
+        const std::size_t num_of_bucket = (inner_size() + low_size - 1) >> RadixLowBits;
+
+        // pass 1 => by high bits, into (inner, outer, value) scratch arrays
+        std::vector<std::vector<std::size_t>> offsets(num_of_thread);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& count = offsets[worker_id];
+            count.assign(num_of_bucket, 0);
+            auto [beg, end] = outer_range(worker_id, num_of_thread);
+            for (std::size_t pos = Ptr[beg]; pos < Ptr[end]; ++pos) {
+                ++count[static_cast<std::size_t>(Indexes[pos]) >> RadixLowBits];
+            }
+        });
+        std::vector<std::size_t> bucket_beg(num_of_bucket + 1, 0);
+        for (std::size_t bucket = 0; bucket < num_of_bucket; ++bucket) {
+            std::size_t sum = bucket_beg[bucket];
+            for (std::vector<std::size_t>& count : offsets) {
+                std::size_t curr = count[bucket];
+                count[bucket]    = sum;
+                sum              += curr;
+            }
+            bucket_beg[bucket + 1] = sum;
+        }
+        std::vector<Index> scratch_inner(get_nnz());
+        std::vector<Index> scratch_outer(get_nnz());
+        std::vector<T>     scratch_value(get_nnz());
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& next = offsets[worker_id];
+            auto [beg, end]                = outer_range(worker_id, num_of_thread);
+            for (std::size_t outer = beg; outer < end; ++outer) {
+                for (std::size_t pos = Ptr[outer]; pos < Ptr[outer + 1]; ++pos) {
+                    std::size_t dest    = next[static_cast<std::size_t>(Indexes[pos]) >> RadixLowBits]++;
+                    scratch_inner[dest] = Indexes[pos];
+                    scratch_outer[dest] = static_cast<Index>(outer);
+                    scratch_value[dest] = Values[pos];
+                }
+            }
+        });
+
+        // pass 2 => inside each high bucket, by the low bits
+        std::vector<std::size_t> ptr(inner_size() + 1, 0);
+        std::vector<Index>       indexes(get_nnz());
+        std::vector<T>           values(get_nnz());
+        Tool::parallel_for(
+            num_of_bucket,
+            [&](std::size_t bucket) {
+                const std::size_t        first_inner = bucket << RadixLowBits;
+                const std::size_t        width       = std::min(low_size, inner_size() - first_inner);
+                std::vector<std::size_t> next(width + 1, 0);
+                for (std::size_t pos = bucket_beg[bucket]; pos < bucket_beg[bucket + 1]; ++pos) {
+                    ++next[static_cast<std::size_t>(scratch_inner[pos]) - first_inner + 1];
+                }
+                next[0] = bucket_beg[bucket];
+                for (std::size_t low = 0; low < width; ++low) {
+                    next[low + 1] += next[low];
+                }
+                std::copy(next.begin() + 1, next.end(), ptr.begin() + first_inner + 1);
+                for (std::size_t pos = bucket_beg[bucket]; pos < bucket_beg[bucket + 1]; ++pos) {
+                    std::size_t dest = next[static_cast<std::size_t>(scratch_inner[pos]) - first_inner]++;
+                    indexes[dest]    = scratch_outer[pos];
+                    values[dest]     = std::move(scratch_value[pos]);
+                }
+            },
+            num_of_thread
+        );
+        return { num_of_row, num_of_col, std::move(ptr), std::move(indexes), std::move(values) };
+    }
+
+    /// @brief @b operator==, same layout and same stored entries
+    friend bool operator==(const CompressedMatrix& lhs, const CompressedMatrix& rhs)
+    requires std::equality_comparable<T>
+    {
+        return lhs.num_of_row == rhs.num_of_row && lhs.num_of_col == rhs.num_of_col
+            && lhs.Ptr == rhs.Ptr && lhs.Indexes == rhs.Indexes && lhs.Values == rhs.Values;
+    }
+};
+
+template <typename T, typename Index = int>
+using CSRMatrix = CompressedMatrix<T, Index, true>;
+
+template <typename T, typename Index = int>
+using CSCMatrix = CompressedMatrix<T, Index, false>;
+
+} // namespace DS
@@ -0,0 +1,195 @@
+/**
+ * @file CoordinateMatrix.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Coordinate (COO) sparse matrix in structure-of-arrays layout
+ * @structure:
+        Rows   => [0, 0, 1, 2]      one array per field instead of one array
+        Cols   => [1, 3, 0, 2]      of { Row, Col, Value } structs, so a pass
+        Values => [a, b, c, d]      over the indexes never loads the values
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "CompressedMatrix.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b CoordinateMatrix (0-based)
+/// `Index` is fixed at compile time: `std::uint16_t` for matrices up to
+/// 65535 x 65535 => 2 x 2 bytes of index per non-zero instead of 2 x 4.
+/// everything is trivially copyable, so every copy is a memcpy
+template <typename T, typename Index = std::int32_t>
+class CoordinateMatrix {
+    static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+public:
+    using ValueType = T;
+    using IndexType = Index;
+
+    static constexpr std::size_t MaxDimension
+        = std::cmp_less(std::numeric_limits<Index>::max(), std::numeric_limits<std::size_t>::max())
+        ? static_cast<std::size_t>(std::numeric_limits<Index>::max()) + 1
+        : std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t BytesOfNonZero = 2 * sizeof(Index) + sizeof(T);
+
+private:
+    std::size_t num_of_row = 0;
+    std::size_t num_of_col = 0;
+
+    std::vector<Index> Rows;
+    std::vector<Index> Cols;
+    std::vector<T>     Values;
+
+    /// @brief @b counting_sort of all the entries on `keys` (stable)
+    CoordinateMatrix sorted_by(const std::vector<Index>& keys, std::size_t num_of_key, bool if_transpose) const {
+        std::vector<std::size_t> location(num_of_key + 1, 0);
+        for (Index key : keys) {
+            ++location[static_cast<std::size_t>(key) + 1];
+        }
+        for (std::size_t key = 0; key < num_of_key; ++key) {
+            location[key + 1] += location[key];
+        }
+        CoordinateMatrix res(if_transpose ? num_of_col : num_of_row, if_transpose ? num_of_row : num_of_col);
+        res.Rows.resize(get_nnz());
+        res.Cols.resize(get_nnz());
+        res.Values.resize(get_nnz());
+
+        const std::vector<Index>& new_rows = if_transpose ? Cols : Rows;
+        const std::vector<Index>& new_cols = if_transpose ? Rows : Cols;
+        for (std::size_t idx = 0; idx < get_nnz(); ++idx) {
+            std::size_t dest = location[static_cast<std::size_t>(keys[idx])]++;
+            res.Rows[dest]   = new_rows[idx];
+            res.Cols[dest]   = new_cols[idx];
+            res.Values[dest] = Values[idx];
+        }
+        return res;
+    }
+
+public:
+    CoordinateMatrix() = default;
+
+    /// @brief throws `std::length_error` when `Index` is too narrow
+    CoordinateMatrix(std::size_t num_of_row, std::size_t num_of_col)
+        : num_of_row(num_of_row)
+        , num_of_col(num_of_col) {
+        if (num_of_row > MaxDimension || num_of_col > MaxDimension) {
+            throw std::length_error("Index type is too narrow for the matrix!");
+        }
+    }
+
+    /// @brief @b getters
+    std::size_t get_num_of_row() const { return num_of_row; }
+    std::size_t get_num_of_col() const { return num_of_col; }
+    std::size_t get_nnz() const { return Values.size(); }
+
+    std::span<const Index> get_rows() const { return Rows; }
+    std::span<const Index> get_cols() const { return Cols; }
+    std::span<const T>     get_values() const { return Values; }
+
+    void reserve(std::size_t num) {
+        Rows.reserve(num);
+        Cols.reserve(num);
+        Values.reserve(num);
+    }
+    /// @brief @b add, throws `std::out_of_range` outside the matrix
+    void add(std::size_t row, std::size_t col, const T& value) {
+        if (row >= num_of_row || col >= num_of_col) {
+            throw std::out_of_range("Entry is outside the matrix!");
+        }
+        Rows.push_back(static_cast<Index>(row));
+        Cols.push_back(static_cast<Index>(col));
+        Values.push_back(value);
+    }
+
+    /// @brief @b if_valid, every index inside the matrix.
+    /// branch-free over one index array at a time => vectorized
+    bool if_valid() const {
+        auto if_inside = [](const std::vector<Index>& indexes, std::size_t bound) {
+            bool res = true;
+            for (Index idx : indexes) {
+                res &= std::cmp_greater_equal(idx, 0) & std::cmp_less(idx, bound);
+            }
+            return res;
+        };
+        return Rows.size() == Values.size() && Cols.size() == Values.size()
+            && if_inside(Rows, num_of_row) && if_inside(Cols, num_of_col);
+    }
+    /// @brief @b if_row_major, entries ordered by (row, col)
+    bool if_row_major() const {
+        for (std::size_t idx = 1; idx < get_nnz(); ++idx) {
+            if (std::pair { Rows[idx], Cols[idx] } < std::pair { Rows[idx - 1], Cols[idx - 1] }) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief @b transpose, counting sort on the col => the same stable
+    /// order as `SparseMatrix::fast_transpose`
+    CoordinateMatrix transpose() const { return sorted_by(Cols, num_of_col, true); }
+
+    /// @brief @b sort_row_major, two stable counting sorts (col, then row)
+    CoordinateMatrix sort_row_major() const {
+        CoordinateMatrix by_col = sorted_by(Cols, num_of_col, false);
+        return by_col.sorted_by(by_col.Rows, num_of_row, false);
+    }
+
+    /// @brief @b to_csr, the entries must be row major (see `sort_row_major`)
+    template <typename CSRIndex = Index>
+    CSRMatrix<T, CSRIndex> to_csr() const {
+        if (!if_row_major()) {
+            throw std::logic_error("Entries are not in row major order!");
+        }
+        std::vector<std::size_t> row_ptr(num_of_row + 1, 0);
+        for (Index row : Rows) {
+            ++row_ptr[static_cast<std::size_t>(row) + 1];
+        }
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            row_ptr[row + 1] += row_ptr[row];
+        }
+        return { num_of_row,
+                 num_of_col,
+                 std::move(row_ptr),
+                 std::vector<CSRIndex>(Cols.begin(), Cols.end()),
+                 Values };
+    }
+    template <typename CSRIndex>
+    static CoordinateMatrix FromCSR(const CSRMatrix<T, CSRIndex>& csr) {
+        CoordinateMatrix res(csr.get_num_of_row(), csr.get_num_of_col());
+        res.Rows.resize(csr.get_nnz());
+        for (std::size_t row = 0; row < csr.get_num_of_row(); ++row) {
+            auto beg = res.Rows.begin() + csr.get_ptr()[row];
+            auto end = res.Rows.begin() + csr.get_ptr()[row + 1];
+            std::fill(beg, end, static_cast<Index>(row));
+        }
+        res.Cols.assign(csr.get_indexes().begin(), csr.get_indexes().end());
+        res.Values.assign(csr.get_values().begin(), csr.get_values().end());
+        return res;
+    }
+
+    friend bool operator==(const CoordinateMatrix& lhs, const CoordinateMatrix& rhs)
+    requires std::equality_comparable<T>
+    {
+        return lhs.num_of_row == rhs.num_of_row && lhs.num_of_col == rhs.num_of_col
+            && lhs.Rows == rhs.Rows && lhs.Cols == rhs.Cols && lhs.Values == rhs.Values;
+    }
+};
+
+} // namespace DS
@@ -0,0 +1,322 @@
+/**
+ * @file MatrixMarket.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Matrix Market (.mtx) coordinate files, mmap + parallel parser
+ * @structure:
+        %%MatrixMarket matrix coordinate real general
+        % any number of comment lines
+        num_of_row num_of_col num_of_entry
+        row col value                           (1-based, one entry per line)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../../tools/MappedFile.hpp"
+#include "../../../tools/Parallel.hpp"
+#include "CompressedMatrix.hpp"
+#include "TripletBuilder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b MatrixMarket, `coordinate` matrices only (no `array`, no complex)
+/// the file is mapped, not read; the body is cut into one chunk per thread
+/// at line boundaries and every chunk is parsed into its own triplets
+class MatrixMarket {
+public:
+    enum class Field { Real, Integer, Pattern };
+    enum class Symmetry { General, Symmetric, SkewSymmetric };
+
+    struct Header {
+        std::size_t num_of_row   = 0;
+        std::size_t num_of_col   = 0;
+        std::size_t num_of_entry = 0; // lines, before symmetric expansion
+        Field       field        = Field::Real;
+        Symmetry    symmetry     = Symmetry::General;
+    };
+
+private:
+    static std::runtime_error broken(const std::string& what) {
+        return std::runtime_error("Broken Matrix Market file: " + what);
+    }
+
+    static std::string lower(std::string_view text) {
+        std::string res(text);
+        for (char& ch : res) {
+            ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+        }
+        return res;
+    }
+    static bool if_blank(char ch) { return ch == ' ' || ch == '\t' || ch == '\r'; }
+
+    /// @brief next line of `text` from `pos` (without the '\n'), moves `pos`
+    static std::string_view next_line(std::string_view text, std::size_t& pos) {
+        std::size_t end = text.find('\n', pos);
+        end             = (end == std::string_view::npos) ? text.size() : end;
+        auto res        = text.substr(pos, end - pos);
+        pos             = std::min(text.size(), end + 1);
+        return res;
+    }
+
+    /// @brief @b parse_header, `pos` => the first byte of the body
+    static Header parse_header(std::string_view text, std::size_t& pos) {
+        pos                    = 0;
+        std::string_view line  = next_line(text, pos);
+        constexpr auto   Magic = std::string_view("%%MatrixMarket");
+        if (line.substr(0, Magic.size()) != Magic) {
+            throw broken("no %%MatrixMarket banner");
+        }
+        std::vector<std::string> words;
+        for (std::size_t beg = Magic.size(); beg < line.size();) {
+            while (beg < line.size() && if_blank(line[beg])) {
+                ++beg;
+            }
+            std::size_t end = beg;
+            while (end < line.size() && !if_blank(line[end])) {
+                ++end;
+            }
+            if (end > beg) {
+                words.push_back(lower(line.substr(beg, end - beg)));
+            }
+            beg = end;
+        }
+        if (words.size() != 4 || words[0] != "matrix") {
+            throw broken("bad banner");
+        }
+        if (words[1] != "coordinate") {
+            throw std::runtime_error("Only coordinate Matrix Market files are supported!");
+        }
+
+        Header res;
+        if (words[2] == "real" || words[2] == "double") {
+            res.field = Field::Real;
+        } else if (words[2] == "integer") {
+            res.field = Field::Integer;
+        } else if (words[2] == "pattern") {
+            res.field = Field::Pattern;
+        } else {
+            throw std::runtime_error("Unsupported Matrix Market field: " + words[2]);
+        }
+        if (words[3] == "general") {
+            res.symmetry = Symmetry::General;
+        } else if (words[3] == "symmetric") {
+            res.symmetry = Symmetry::Symmetric;
+        } else if (words[3] == "skew-symmetric") {
+            res.symmetry = Symmetry::SkewSymmetric;
+        } else {
+            throw std::runtime_error("Unsupported Matrix Market symmetry: " + words[3]);
+        }
+
+        // comments, then the size line
+        while (pos < text.size()) {
+            line             = next_line(text, pos);
+            const char* curr = line.data();
+            const char* end  = line.data() + line.size();
+            skip_blank(curr, end);
+            if (curr == end || *curr == '%') {
+                continue;
+            }
+            if (!parse_index(curr, end, res.num_of_row) || !parse_index(curr, end, res.num_of_col)
+                || !parse_index(curr, end, res.num_of_entry)) {
+                throw broken("bad size line");
+            }
+            return res;
+        }
+        throw broken("no size line");
+    }
+
+    static void skip_blank(const char*& curr, const char* end) {
+        while (curr != end && if_blank(*curr)) {
+            ++curr;
+        }
+    }
+    /// @brief @b parse_index, plain decimal digits after blanks
+    static bool parse_index(const char*& curr, const char* end, std::size_t& res) {
+        skip_blank(curr, end);
+        const char* first = curr;
+        res               = 0;
+        while (curr != end && static_cast<unsigned>(*curr - '0') < 10) {
+            res = res * 10 + static_cast<std::size_t>(*curr - '0');
+            ++curr;
+        }
+        return curr != first;
+    }
+    /// @brief @b parse_value, `std::from_chars` (no locale, no allocation)
+    template <typename T>
+    static bool parse_value(const char*& curr, const char* end, Field field, T& res) {
+        skip_blank(curr, end);
+        if (curr != end && *curr == '+') {
+            ++curr; // from_chars does not take a leading '+'
+        }
+        std::from_chars_result parsed;
+        if constexpr (std::is_floating_point_v<T>) {
+            parsed = std::from_chars(curr, end, res);
+        } else {
+            if (field == Field::Real) {
+                double value = 0;
+                parsed       = std::from_chars(curr, end, value);
+                res          = static_cast<T>(value);
+            } else {
+                parsed = std::from_chars(curr, end, res);
+            }
+        }
+        curr = parsed.ptr;
+        return parsed.ec == std::errc {};
+    }
+
+    /// @brief @b parse_chunk => every entry line of `text`, returns their number
+    template <typename T, typename Index>
+    static std::size_t parse_chunk(
+        std::string_view          text,
+        const Header&             header,
+        TripletBuilder<T, Index>& res
+    ) {
+        std::size_t num_of_line = 0;
+        for (std::size_t pos = 0; pos < text.size();) {
+            std::string_view line = next_line(text, pos);
+            const char*      curr = line.data();
+            const char*      end  = line.data() + line.size();
+            skip_blank(curr, end);
+            if (curr == end || *curr == '%') {
+                continue;
+            }
+            std::size_t row = 0;
+            std::size_t col = 0;
+            T           value {};
+            if (!parse_index(curr, end, row) || !parse_index(curr, end, col)) {
+                throw broken("bad entry \"" + std::string(line) + "\"");
+            }
+            if (header.field == Field::Pattern) {
+                value = T { 1 };
+            } else if (!parse_value(curr, end, header.field, value)) {
+                throw broken("bad value \"" + std::string(line) + "\"");
+            }
+            if (row == 0 || col == 0 || row > header.num_of_row || col > header.num_of_col) {
+                throw broken("entry outside the matrix \"" + std::string(line) + "\"");
+            }
+            res.add(row - 1, col - 1, value);
+            if (header.symmetry != Symmetry::General && row != col) {
+                res.add(col - 1, row - 1, header.symmetry == Symmetry::Symmetric ? value : T {} - value);
+            }
+            ++num_of_line;
+        }
+        return num_of_line;
+    }
+
+public:
+    /// @brief @b read_header only, cheap even for huge files
+    static Header read_header(const std::string& path) {
+        Tool::MappedFile file(path);
+        std::size_t      pos = 0;
+        return parse_header(file.text(), pos);
+    }
+
+    /// @brief @b parse the whole text of a file, one chunk per thread
+    template <typename T, typename Index = int>
+    static TripletBuilder<T, Index> parse(
+        std::string_view text,
+        unsigned         num_of_thread = Tool::num_of_worker()
+    ) {
+        std::size_t      body_pos = 0;
+        const Header     header   = parse_header(text, body_pos);
+        std::string_view body     = text.substr(body_pos);
+
+        // chunk `w` starts right after the first '\n' at or past its cut
+        // and no chunk is smaller than a few pages
+        num_of_thread = static_cast<unsigned>(
+            std::clamp<std::size_t>(body.size() / 4096, 1, std::max(1u, num_of_thread))
+        );
+        std::vector<std::size_t> cuts(num_of_thread + 1, body.size());
+        cuts[0] = 0;
+        for (unsigned part = 1; part < num_of_thread; ++part) {
+            std::size_t cut = body.find('\n', body.size() * part / num_of_thread);
+            cuts[part]      = (cut == std::string_view::npos) ? body.size() : cut + 1;
+        }
+
+        std::vector<TripletBuilder<T, Index>> parts(
+            num_of_thread,
+            TripletBuilder<T, Index>(header.num_of_row, header.num_of_col)
+        );
+        std::atomic<std::size_t> num_of_line { 0 };
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::size_t beg = std::min(cuts[worker_id], cuts[worker_id + 1]);
+            auto        sub = body.substr(beg, cuts[worker_id + 1] - beg);
+            parts[worker_id].reserve(header.num_of_entry / num_of_thread + 1);
+            num_of_line += parse_chunk(sub, header, parts[worker_id]);
+        });
+        if (num_of_line != header.num_of_entry) {
+            throw broken(
+                std::to_string(num_of_line) + " entries, " + std::to_string(header.num_of_entry) + " expected"
+            );
+        }
+
+        TripletBuilder<T, Index> res(header.num_of_row, header.num_of_col);
+        for (TripletBuilder<T, Index>& part : parts) {
+            res.append(std::move(part));
+        }
+        return res;
+    }
+
+    /// @brief @b load a `.mtx` file as CSR, duplicated entries are summed
+    template <typename T, typename Index = int>
+    static CSRMatrix<T, Index> load(const std::string& path, unsigned num_of_thread = Tool::num_of_worker()) {
+        Tool::MappedFile file(path);
+        return parse<T, Index>(file.text(), num_of_thread)
+            .build(TripletBuilder<T, Index>::Duplicate::Sum, num_of_thread);
+    }
+
+    /// @brief @b save as `coordinate real general` (`integer` for integral T)
+    template <typename T, typename Index>
+    static void save(const std::string& path, const CSRMatrix<T, Index>& matrix) {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        out << "%%MatrixMarket matrix coordinate " << (std::is_integral_v<T> ? "integer" : "real") << " general\n"
+            << matrix.get_num_of_row() << ' ' << matrix.get_num_of_col() << ' ' << matrix.get_nnz() << '\n';
+
+        std::string buffer;
+        char        number[64];
+        auto        put = [&](auto value) {
+            auto res = std::to_chars(number, number + sizeof(number), value);
+            buffer.append(number, res.ptr);
+        };
+        for (std::size_t row = 0; row < matrix.get_num_of_row(); ++row) {
+            for (std::size_t pos = matrix.get_ptr()[row]; pos < matrix.get_ptr()[row + 1]; ++pos) {
+                put(row + 1);
+                buffer += ' ';
+                put(static_cast<std::size_t>(matrix.get_indexes()[pos]) + 1);
+                buffer += ' ';
+                put(matrix.get_values()[pos]); // shortest round-trip form
+                buffer += '\n';
+            }
+            if (buffer.size() > (1 << 20)) {
+                out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }
+};
+
+} // namespace DS
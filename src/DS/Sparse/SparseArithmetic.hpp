@@ -0,0 +1,365 @@
+/**
+ * @file SparseArithmetic.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Sparse * sparse (SpGEMM, Gustavson) and sparse +/- on CSR
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../../tools/Parallel.hpp"
+#include "CompressedMatrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b SparseRowAccumulator
+/// collects `col => value` for one output row of a SpGEMM.
+/// dense mode => a `num_of_col` array, for rows that touch a good part
+/// of it; hash mode => open addressing sized by the row's flop count.
+/// slots are "cleared" by bumping a stamp, never by a memset.
+template <typename T, typename Index>
+class SparseRowAccumulator {
+public:
+    /// @brief dense mode once the flops reach `num_of_col / DenseRatio`
+    static constexpr std::size_t DenseRatio = 16;
+
+private:
+    std::size_t num_of_col = 0;
+    bool        if_dense   = false;
+
+    std::vector<T>             DenseValues;
+    std::vector<std::uint32_t> DenseStamps;
+
+    std::vector<Index>         HashKeys;
+    std::vector<T>             HashValues;
+    std::vector<std::uint32_t> HashStamps;
+    std::size_t                hash_mask = 0;
+
+    std::vector<std::size_t> Touched; // col (dense) or slot (hash)
+    std::uint32_t            stamp = 0;
+
+    std::size_t hash_slot(Index col) const {
+        return (static_cast<std::size_t>(col) * 0x9E3779B97F4A7C15ULL >> 20) & hash_mask;
+    }
+
+public:
+    explicit SparseRowAccumulator(std::size_t num_of_col)
+        : num_of_col(num_of_col) { }
+
+    /// @brief @b start a new row, `flops` => upper bound of its entries
+    void start(std::size_t flops) {
+        if (++stamp == 0) { // wrapped, old stamps would collide
+            std::fill(DenseStamps.begin(), DenseStamps.end(), 0);
+            std::fill(HashStamps.begin(), HashStamps.end(), 0);
+            stamp = 1;
+        }
+        Touched.clear();
+        if_dense = flops * DenseRatio >= num_of_col;
+        if (if_dense) {
+            if (DenseStamps.empty()) {
+                DenseValues.resize(num_of_col);
+                DenseStamps.assign(num_of_col, 0);
+            }
+            return;
+        }
+        std::size_t capacity = 16;
+        while (capacity < 2 * flops) {
+            capacity *= 2;
+        }
+        if (capacity > HashKeys.size()) {
+            HashKeys.resize(capacity);
+            HashValues.resize(capacity);
+            HashStamps.assign(capacity, 0);
+        }
+        hash_mask = std::min(capacity, HashKeys.size()) - 1;
+    }
+
+    /// @brief @b add `value` at `col`, `IfNumeric = false` => structure only
+    template <bool IfNumeric>
+    void add(Index col, const T& value) {
+        if (if_dense) {
+            if (DenseStamps[col] != stamp) {
+                DenseStamps[col] = stamp;
+                Touched.push_back(static_cast<std::size_t>(col));
+                if constexpr (IfNumeric) {
+                    DenseValues[col] = value;
+                }
+            } else if constexpr (IfNumeric) {
+                DenseValues[col] += value;
+            }
+            return;
+        }
+        for (std::size_t slot = hash_slot(col);; slot = (slot + 1) & hash_mask) {
+            if (HashStamps[slot] != stamp) {
+                HashStamps[slot] = stamp;
+                HashKeys[slot]   = col;
+                Touched.push_back(slot);
+                if constexpr (IfNumeric) {
+                    HashValues[slot] = value;
+                }
+                return;
+            }
+            if (HashKeys[slot] == col) {
+                if constexpr (IfNumeric) {
+                    HashValues[slot] += value;
+                }
+                return;
+            }
+        }
+    }
+
+    std::size_t size() const { return Touched.size(); }
+
+    /// @brief @b flush the row into `cols` / `values`, ordered by col
+    void flush(Index* cols, T* values) {
+        if (if_dense) {
+            std::sort(Touched.begin(), Touched.end());
+            for (std::size_t idx = 0; idx < Touched.size(); ++idx) {
+                cols[idx]   = static_cast<Index>(Touched[idx]);
+                values[idx] = DenseValues[Touched[idx]];
+            }
+            return;
+        }
+        std::sort(Touched.begin(), Touched.end(), [&](std::size_t lhs, std::size_t rhs) {
+            return HashKeys[lhs] < HashKeys[rhs];
+        });
+        for (std::size_t idx = 0; idx < Touched.size(); ++idx) {
+            cols[idx]   = HashKeys[Touched[idx]];
+            values[idx] = HashValues[Touched[idx]];
+        }
+    }
+};
+
+/// @brief @b SparseArithmetic on CSR matrices
+/// every operation runs twice over the rows: the symbolic pass counts the
+/// entries of each output row, a prefix sum sizes the output exactly, the
+/// numeric pass writes every row in place. rows are split over threads by
+/// their estimated cost. entries that cancel to zero are kept (structural).
+class SparseArithmetic {
+    /// @brief bounds[w] .. bounds[w + 1] => rows of worker `w`,
+    /// balanced on the running cost `prefix` (num_of_row + 1 items)
+    static std::vector<std::size_t> balanced_bounds(
+        const std::vector<std::size_t>& prefix,
+        unsigned                        num_of_thread
+    ) {
+        const std::size_t        num_of_row = prefix.size() - 1;
+        std::vector<std::size_t> bounds(num_of_thread + 1, num_of_row);
+        bounds[0] = 0;
+        for (unsigned part = 1; part < num_of_thread; ++part) {
+            std::size_t target = prefix.back() * part / num_of_thread;
+            bounds[part]       = static_cast<std::size_t>(
+                std::lower_bound(prefix.begin(), prefix.end() - 1, target) - prefix.begin()
+            );
+        }
+        return bounds;
+    }
+    static unsigned clamp_thread(std::size_t num_of_row, unsigned num_of_thread) {
+        return static_cast<unsigned>(std::clamp<std::size_t>(num_of_row, 1, std::max(1u, num_of_thread)));
+    }
+    static void prefix_sum(std::vector<std::size_t>& counts) {
+        std::size_t sum = 0;
+        for (std::size_t& count : counts) {
+            std::size_t curr = count;
+            count            = sum;
+            sum              += curr;
+        }
+    }
+
+    /// @brief @b merge_rows, sign = +1 / -1, `IfNumeric = false` => count only
+    template <bool IfNumeric, typename T, typename Index>
+    static std::size_t merge_rows(
+        const CSRMatrix<T, Index>& lhs,
+        const CSRMatrix<T, Index>& rhs,
+        std::size_t                row,
+        bool                       if_subtract,
+        Index*                     cols,
+        T*                         values
+    ) {
+        auto        lhs_cols = lhs.get_indexes();
+        auto        rhs_cols = rhs.get_indexes();
+        auto        lhs_vals = lhs.get_values();
+        auto        rhs_vals = rhs.get_values();
+        std::size_t lhs_pos  = lhs.get_ptr()[row];
+        std::size_t rhs_pos  = rhs.get_ptr()[row];
+        std::size_t lhs_end  = lhs.get_ptr()[row + 1];
+        std::size_t rhs_end  = rhs.get_ptr()[row + 1];
+        std::size_t num      = 0;
+        auto        emit     = [&](Index col, const T& value) {
+            if constexpr (IfNumeric) {
+                cols[num]   = col;
+                values[num] = value;
+            }
+            ++num;
+        };
+        auto rhs_value = [&](std::size_t pos) { return if_subtract ? T {} - rhs_vals[pos] : rhs_vals[pos]; };
+        while (lhs_pos < lhs_end && rhs_pos < rhs_end) {
+            if (lhs_cols[lhs_pos] < rhs_cols[rhs_pos]) {
+                emit(lhs_cols[lhs_pos], lhs_vals[lhs_pos]);
+                ++lhs_pos;
+            } else if (rhs_cols[rhs_pos] < lhs_cols[lhs_pos]) {
+                emit(rhs_cols[rhs_pos], rhs_value(rhs_pos));
+                ++rhs_pos;
+            } else {
+                emit(
+                    lhs_cols[lhs_pos],
+                    if_subtract ? lhs_vals[lhs_pos] - rhs_vals[rhs_pos] : lhs_vals[lhs_pos] + rhs_vals[rhs_pos]
+                );
+                ++lhs_pos;
+                ++rhs_pos;
+            }
+        }
+        for (; lhs_pos < lhs_end; ++lhs_pos) {
+            emit(lhs_cols[lhs_pos], lhs_vals[lhs_pos]);
+        }
+        for (; rhs_pos < rhs_end; ++rhs_pos) {
+            emit(rhs_cols[rhs_pos], rhs_value(rhs_pos));
+        }
+        return num;
+    }
+
+    template <typename T, typename Index>
+    static CSRMatrix<T, Index> add_or_subtract(
+        const CSRMatrix<T, Index>& lhs,
+        const CSRMatrix<T, Index>& rhs,
+        bool                       if_subtract,
+        unsigned                   num_of_thread
+    ) {
+        if (lhs.get_num_of_row() != rhs.get_num_of_row() || lhs.get_num_of_col() != rhs.get_num_of_col()) {
+            throw std::invalid_argument("Matrix sizes do not match!");
+        }
+        const std::size_t num_of_row = lhs.get_num_of_row();
+        num_of_thread                = clamp_thread(num_of_row, num_of_thread);
+
+        std::vector<std::size_t> cost(num_of_row + 1, 0);
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            cost[row + 1] = cost[row] + (lhs.get_ptr()[row + 1] - lhs.get_ptr()[row])
+                + (rhs.get_ptr()[row + 1] - rhs.get_ptr()[row]) + 1;
+        }
+        std::vector<std::size_t> bounds = balanced_bounds(cost, num_of_thread);
+
+        // symbolic
+        std::vector<std::size_t> row_ptr(num_of_row + 1, 0);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            for (std::size_t row = bounds[worker_id]; row < bounds[worker_id + 1]; ++row) {
+                row_ptr[row] = merge_rows<false, T, Index>(lhs, rhs, row, if_subtract, nullptr, nullptr);
+            }
+        });
+        prefix_sum(row_ptr);
+
+        // numeric
+        std::vector<Index> cols(row_ptr.back());
+        std::vector<T>     values(row_ptr.back());
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            for (std::size_t row = bounds[worker_id]; row < bounds[worker_id + 1]; ++row) {
+                merge_rows<true, T, Index>(
+                    lhs, rhs, row, if_subtract, cols.data() + row_ptr[row], values.data() + row_ptr[row]
+                );
+            }
+        });
+        return { num_of_row, lhs.get_num_of_col(), std::move(row_ptr), std::move(cols), std::move(values) };
+    }
+
+public:
+    /// @brief @b multiply => lhs * rhs (Gustavson, row by row)
+    /// row `i` of the result = sum over `k` of lhs[i][k] * (row `k` of rhs),
+    /// so no intermediate product is ever stored outside one accumulator
+    template <typename T, typename Index>
+    static CSRMatrix<T, Index> multiply(
+        const CSRMatrix<T, Index>& lhs,
+        const CSRMatrix<T, Index>& rhs,
+        unsigned                   num_of_thread = 1
+    ) {
+        if (lhs.get_num_of_col() != rhs.get_num_of_row()) {
+            throw std::invalid_argument("Matrix sizes do not match for multiplication!");
+        }
+        const std::size_t num_of_row = lhs.get_num_of_row();
+        const std::size_t num_of_col = rhs.get_num_of_col();
+        num_of_thread                = clamp_thread(num_of_row, num_of_thread);
+
+        auto lhs_ptr  = lhs.get_ptr();
+        auto lhs_cols = lhs.get_indexes();
+        auto lhs_vals = lhs.get_values();
+        auto rhs_ptr  = rhs.get_ptr();
+        auto rhs_cols = rhs.get_indexes();
+        auto rhs_vals = rhs.get_values();
+
+        // flops per row => accumulator size and the thread split
+        std::vector<std::size_t> flops(num_of_row + 1, 0);
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            std::size_t curr = 0;
+            for (std::size_t pos = lhs_ptr[row]; pos < lhs_ptr[row + 1]; ++pos) {
+                curr += rhs_ptr[lhs_cols[pos] + 1] - rhs_ptr[lhs_cols[pos]];
+            }
+            flops[row + 1] = flops[row] + curr;
+        }
+        std::vector<std::size_t> bounds = balanced_bounds(flops, num_of_thread);
+
+        auto accumulate = [&]<bool IfNumeric>(SparseRowAccumulator<T, Index>& acc, std::size_t row) {
+            acc.start(flops[row + 1] - flops[row]);
+            for (std::size_t pos = lhs_ptr[row]; pos < lhs_ptr[row + 1]; ++pos) {
+                const std::size_t mid = static_cast<std::size_t>(lhs_cols[pos]);
+                for (std::size_t inner = rhs_ptr[mid]; inner < rhs_ptr[mid + 1]; ++inner) {
+                    if constexpr (IfNumeric) {
+                        acc.template add<true>(rhs_cols[inner], lhs_vals[pos] * rhs_vals[inner]);
+                    } else {
+                        acc.template add<false>(rhs_cols[inner], T {});
+                    }
+                }
+            }
+        };
+
+        // symbolic
+        std::vector<std::size_t> row_ptr(num_of_row + 1, 0);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            SparseRowAccumulator<T, Index> acc(num_of_col);
+            for (std::size_t row = bounds[worker_id]; row < bounds[worker_id + 1]; ++row) {
+                accumulate.template operator()<false>(acc, row);
+                row_ptr[row] = acc.size();
+            }
+        });
+        prefix_sum(row_ptr);
+
+        // numeric
+        std::vector<Index> cols(row_ptr.back());
+        std::vector<T>     values(row_ptr.back());
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            SparseRowAccumulator<T, Index> acc(num_of_col);
+            for (std::size_t row = bounds[worker_id]; row < bounds[worker_id + 1]; ++row) {
+                accumulate.template operator()<true>(acc, row);
+                acc.flush(cols.data() + row_ptr[row], values.data() + row_ptr[row]);
+            }
+        });
+        return { num_of_row, num_of_col, std::move(row_ptr), std::move(cols), std::move(values) };
+    }
+
+    /// @brief @b add / @b subtract => merge of the sorted rows
+    template <typename T, typename Index>
+    static CSRMatrix<T, Index> add(
+        const CSRMatrix<T, Index>& lhs,
+        const CSRMatrix<T, Index>& rhs,
+        unsigned                   num_of_thread = 1
+    ) {
+        return add_or_subtract(lhs, rhs, false, num_of_thread);
+    }
+    template <typename T, typename Index>
+    static CSRMatrix<T, Index> subtract(
+        const CSRMatrix<T, Index>& lhs,
+        const CSRMatrix<T, Index>& rhs,
+        unsigned                   num_of_thread = 1
+    ) {
+        return add_or_subtract(lhs, rhs, true, num_of_thread);
+    }
+};
+
+} // namespace DS
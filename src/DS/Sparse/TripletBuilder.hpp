@@ -0,0 +1,175 @@
+/**
+ * @file TripletBuilder.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Collect (row, col, value) triplets in any order, build a CSR matrix
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../../tools/Parallel.hpp"
+#include "CompressedMatrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace DS {
+
+/// @brief @b TripletBuilder (0-based)
+/// `add` only appends, all the work is done once in `build`:
+/// a counting sort on the row, then every row is sorted on the col and its
+/// duplicates merged, rows in parallel, and the result compacted in place
+template <typename T, typename Index = int>
+class TripletBuilder {
+public:
+    enum class Duplicate {
+        Sum,      // sum of all the values at one position
+        KeepLast, // the value added last wins
+    };
+
+    /// @brief rows and cols are stored as `Index` => at most its max
+    static constexpr std::size_t MaxDimension
+        = std::cmp_less(std::numeric_limits<Index>::max(), std::numeric_limits<std::size_t>::max())
+        ? static_cast<std::size_t>(std::numeric_limits<Index>::max())
+        : std::numeric_limits<std::size_t>::max();
+
+private:
+    std::size_t num_of_row = 0;
+    std::size_t num_of_col = 0;
+
+    std::vector<Index> Rows;
+    std::vector<Index> Cols;
+    std::vector<T>     Values;
+
+public:
+    /// @brief throws `std::length_error` when `Index` is too narrow
+    TripletBuilder(std::size_t num_of_row, std::size_t num_of_col)
+        : num_of_row(num_of_row)
+        , num_of_col(num_of_col) {
+        if (num_of_row > MaxDimension || num_of_col > MaxDimension) {
+            throw std::length_error("Index type is too narrow for the matrix!");
+        }
+    }
+
+    std::size_t get_num_of_row() const { return num_of_row; }
+    std::size_t get_num_of_col() const { return num_of_col; }
+    std::size_t size() const { return Rows.size(); }
+
+    void reserve(std::size_t num) {
+        Rows.reserve(num);
+        Cols.reserve(num);
+        Values.reserve(num);
+    }
+
+    /// @brief @b add, throws `std::out_of_range` outside the matrix
+    void add(std::size_t row, std::size_t col, const T& value) {
+        if (row >= num_of_row || col >= num_of_col) {
+            throw std::out_of_range("Triplet is outside the matrix!");
+        }
+        Rows.push_back(static_cast<Index>(row));
+        Cols.push_back(static_cast<Index>(col));
+        Values.push_back(value);
+    }
+
+    /// @brief @b append all the triplets of `part`, which come after ours
+    void append(TripletBuilder&& part) {
+        if (part.num_of_row != num_of_row || part.num_of_col != num_of_col) {
+            throw std::invalid_argument("Matrix sizes do not match!");
+        }
+        if (Rows.empty()) {
+            Rows   = std::move(part.Rows);
+            Cols   = std::move(part.Cols);
+            Values = std::move(part.Values);
+            return;
+        }
+        Rows.insert(Rows.end(), part.Rows.begin(), part.Rows.end());
+        Cols.insert(Cols.end(), part.Cols.begin(), part.Cols.end());
+        Values.insert(
+            Values.end(),
+            std::make_move_iterator(part.Values.begin()),
+            std::make_move_iterator(part.Values.end())
+        );
+    }
+
+    /// @brief @b build the CSR matrix, cols ascending and unique in every row
+    CSRMatrix<T, Index> build(Duplicate policy = Duplicate::Sum, unsigned num_of_thread = 1) const {
+        // counting sort on the row, stable => `KeepLast` sees the add order
+        std::vector<std::size_t> row_ptr(num_of_row + 1, 0);
+        for (Index row : Rows) {
+            ++row_ptr[row + 1];
+        }
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            row_ptr[row + 1] += row_ptr[row];
+        }
+        std::vector<std::pair<Index, T>> entries(Rows.size());
+        std::vector<std::size_t>         next(row_ptr.begin(), row_ptr.end() - 1);
+        for (std::size_t idx = 0; idx < Rows.size(); ++idx) {
+            entries[next[Rows[idx]]++] = { Cols[idx], Values[idx] };
+        }
+
+        // sort and merge inside every row, `num_of_unique[row]` survive
+        auto by_col = [](const std::pair<Index, T>& lhs, const std::pair<Index, T>& rhs) {
+            return lhs.first < rhs.first;
+        };
+        std::vector<std::size_t> num_of_unique(num_of_row + 1, 0);
+        Tool::parallel_for_range(
+            num_of_row,
+            [&](unsigned, std::size_t beg, std::size_t end) {
+                for (std::size_t row = beg; row < end; ++row) {
+                    auto first = entries.begin() + row_ptr[row];
+                    auto last  = entries.begin() + row_ptr[row + 1];
+                    if (!std::is_sorted(first, last, by_col)) {
+                        std::stable_sort(first, last, by_col);
+                    }
+                    auto dest = first;
+                    for (auto curr = first; curr != last; ++curr) {
+                        if (dest != first && (dest - 1)->first == curr->first) {
+                            if (policy == Duplicate::Sum) {
+                                (dest - 1)->second += curr->second;
+                            } else {
+                                (dest - 1)->second = std::move(curr->second);
+                            }
+                        } else {
+                            if (dest != curr) {
+                                *dest = std::move(*curr);
+                            }
+                            ++dest;
+                        }
+                    }
+                    num_of_unique[row + 1] = static_cast<std::size_t>(dest - first);
+                }
+            },
+            num_of_thread
+        );
+        for (std::size_t row = 0; row < num_of_row; ++row) {
+            num_of_unique[row + 1] += num_of_unique[row];
+        }
+
+        std::vector<Index> cols(num_of_unique.back());
+        std::vector<T>     values(num_of_unique.back());
+        Tool::parallel_for_range(
+            num_of_row,
+            [&](unsigned, std::size_t beg, std::size_t end) {
+                for (std::size_t row = beg; row < end; ++row) {
+                    for (std::size_t idx = 0; idx < num_of_unique[row + 1] - num_of_unique[row]; ++idx) {
+                        cols[num_of_unique[row] + idx]   = entries[row_ptr[row] + idx].first;
+                        values[num_of_unique[row] + idx] = std::move(entries[row_ptr[row] + idx].second);
+                    }
+                }
+            },
+            num_of_thread
+        );
+        return { num_of_row, num_of_col, std::move(num_of_unique), std::move(cols), std::move(values) };
+    }
+};
+
+} // namespace DS
@@ -10,11 +10,26 @@
  */
 
 #pragma once
+#include "../../tools/Parallel.hpp"
+#include "Sparse/BlockMatrix.hpp"
+#include "Sparse/CompressedMatrix.hpp"
+#include "Sparse/CoordinateMatrix.hpp"
+#include "Sparse/MatrixMarket.hpp"
+#include "Sparse/SparseArithmetic.hpp"
+#include "Sparse/TripletBuilder.hpp"
+
+#include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace DS {
@@ -32,34 +47,13 @@ struct ElementInfo {
         : Row(Row)
         , Col(Col)
         , Value(Value) { }
-    ElementInfo(const ElementInfo& copied)
-        : Row(copied.Row)
-        , Col(copied.Col)
-        , Value(copied.Value) { }
-    ElementInfo(ElementInfo&& moved) noexcept
-        : Row(std::move(moved.Row))
-        , Col(std::move(moved.Col))
-        , Value(std::move(moved.Value)) {
-        moved.Row = 0;
-        moved.Col = 0;
-    }
-    ElementInfo& operator=(const ElementInfo& copied) {
-        if (&copied == this) {
-            return *this;
-        }
-        Row   = copied.Row;
-        Col   = copied.Col;
-        Value = copied.Value;
-        return *this;
-    }
-    ElementInfo& operator=(ElementInfo&& moved) noexcept {
-        Row       = moved.Row;
-        Col       = moved.Col;
-        Value     = std::move(moved.Value);
-        moved.Row = 0;
-        moved.Col = 0;
-        return *this;
-    }
+
+    // defaulted => trivially copyable whenever `T` is, so vectors of it
+    // are copied with memcpy and transposes can be vectorized
+    ElementInfo(const ElementInfo&)            = default;
+    ElementInfo(ElementInfo&&) noexcept        = default;
+    ElementInfo& operator=(const ElementInfo&) = default;
+    ElementInfo& operator=(ElementInfo&&)      = default;
 
     /// @brief @b operator==
     friend bool operator==(const ElementInfo<T>& lhs, const ElementInfo<T>& rhs)
@@ -143,6 +137,147 @@ public:
         return *this;
     }
 
+    /// @brief @b getters
+    int                                get_num_of_row() const { return Sizeof_Row; }
+    int                                get_num_of_col() const { return Sizeof_Col; }
+    const std::vector<ElementInfo<T>>& get_data() const { return Data; }
+
+    /// @brief @b to_csr (0-based), counting sort on the row,
+    /// cols inside a row are sorted only if the triples were not
+    template <typename Index = int>
+    CSRMatrix<T, Index> to_csr() const {
+        std::vector<std::size_t> row_ptr(Sizeof_Row + 1, 0);
+        for (const ElementInfo<T>& curr : Data) {
+            ++row_ptr[curr.Row];
+        }
+        for (int row = 0; row < Sizeof_Row; ++row) {
+            row_ptr[row + 1] += row_ptr[row];
+        }
+        std::vector<Index>       col_index(Data.size());
+        std::vector<T>           values(Data.size());
+        std::vector<std::size_t> next(row_ptr.begin(), row_ptr.end() - 1);
+        for (const ElementInfo<T>& curr : Data) {
+            std::size_t dest = next[curr.Row - 1]++;
+            col_index[dest]  = static_cast<Index>(curr.Col - 1);
+            values[dest]     = curr.Value;
+        }
+        for (int row = 0; row < Sizeof_Row; ++row) {
+            auto beg = col_index.begin() + row_ptr[row];
+            auto end = col_index.begin() + row_ptr[row + 1];
+            if (std::is_sorted(beg, end)) {
+                continue;
+            }
+            std::vector<std::pair<Index, T>> entries;
+            for (auto iter = beg; iter != end; ++iter) {
+                entries.emplace_back(*iter, values[iter - col_index.begin()]);
+            }
+            std::stable_sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+            for (std::size_t idx = 0; idx < entries.size(); ++idx) {
+                col_index[row_ptr[row] + idx] = entries[idx].first;
+                values[row_ptr[row] + idx]    = std::move(entries[idx].second);
+            }
+        }
+        return { static_cast<std::size_t>(Sizeof_Row),
+                 static_cast<std::size_t>(Sizeof_Col),
+                 std::move(row_ptr),
+                 std::move(col_index),
+                 std::move(values) };
+    }
+    template <typename Index = int>
+    CSCMatrix<T, Index> to_csc() const {
+        return to_csr<Index>().convert();
+    }
+
+    /// @brief @b to_coordinate => structure-of-arrays copy (0-based),
+    /// `Index` picks the width of the index arrays at compile time
+    template <typename Index = std::int32_t>
+    CoordinateMatrix<T, Index> to_coordinate() const {
+        CoordinateMatrix<T, Index> res(Sizeof_Row, Sizeof_Col);
+        res.reserve(Data.size());
+        for (const ElementInfo<T>& curr : Data) {
+            res.add(curr.Row - 1, curr.Col - 1, curr.Value);
+        }
+        return res;
+    }
+    template <typename Index>
+    static SparseMatrix<T> FromCoordinate(const CoordinateMatrix<T, Index>& soa) {
+        SparseMatrix<T> res;
+        res.Sizeof_Row = static_cast<int>(soa.get_num_of_row());
+        res.Sizeof_Col = static_cast<int>(soa.get_num_of_col());
+        res.Data.resize(soa.get_nnz());
+        for (std::size_t idx = 0; idx < soa.get_nnz(); ++idx) {
+            res.Data[idx] = { static_cast<int>(soa.get_rows()[idx]) + 1,
+                              static_cast<int>(soa.get_cols()[idx]) + 1,
+                              soa.get_values()[idx] };
+        }
+        return res;
+    }
+
+    /// @brief @b FromDense, a flat row-major view, no `vector<vector>` copy:
+    /// one pass counts the non-zeros, so `Data` is allocated exactly once
+    static SparseMatrix<T> FromDense(std::span<const T> dense, int num_of_row, int num_of_col) {
+        if (num_of_row < 0 || num_of_col < 0
+            || dense.size() != static_cast<std::size_t>(num_of_row) * static_cast<std::size_t>(num_of_col)) {
+            throw std::invalid_argument("Dense size does not match the matrix!");
+        }
+        SparseMatrix<T> res;
+        res.Sizeof_Row = num_of_row;
+        res.Sizeof_Col = num_of_col;
+        auto num_of_nonzero = std::count_if(dense.begin(), dense.end(), [](const T& value) { return value != T {}; });
+        res.Data.reserve(static_cast<std::size_t>(num_of_nonzero));
+        for (int row_index = 0; row_index < num_of_row; ++row_index) {
+            const T* row = dense.data() + static_cast<std::size_t>(row_index) * num_of_col;
+            for (int col_index = 0; col_index < num_of_col; ++col_index) {
+                if (row[col_index] != T {}) {
+                    res.Data.emplace_back(row_index + 1, col_index + 1, row[col_index]);
+                }
+            }
+        }
+        return res;
+    }
+
+    /// @brief @b FromMatrixMarket (.mtx), see `MatrixMarket::load`
+    static SparseMatrix<T> FromMatrixMarket(
+        const std::string& path,
+        unsigned           num_of_thread = Tool::num_of_worker()
+    ) {
+        return FromCSR(MatrixMarket::load<T>(path, num_of_thread));
+    }
+
+    /// @brief @b FromCSR, back to 1-based triples in row-major order
+    template <typename Index>
+    static SparseMatrix<T> FromCSR(const CSRMatrix<T, Index>& csr) {
+        SparseMatrix<T> res;
+        res.Sizeof_Row = static_cast<int>(csr.get_num_of_row());
+        res.Sizeof_Col = static_cast<int>(csr.get_num_of_col());
+        res.Data.reserve(csr.get_nnz());
+        auto row_ptr = csr.get_ptr();
+        for (std::size_t row = 0; row < csr.get_num_of_row(); ++row) {
+            for (std::size_t pos = row_ptr[row]; pos < row_ptr[row + 1]; ++pos) {
+                res.Data.emplace_back(
+                    static_cast<int>(row + 1),
+                    static_cast<int>(csr.get_indexes()[pos] + 1),
+                    csr.get_values()[pos]
+                );
+            }
+        }
+        return res;
+    }
+
+    /// @brief @b arithmetic, through CSR (see `SparseArithmetic`),
+    /// throws `std::invalid_argument` when the sizes do not match
+    friend SparseMatrix<T> operator*(const SparseMatrix<T>& lhs, const SparseMatrix<T>& rhs) {
+        return FromCSR(SparseArithmetic::multiply(lhs.to_csr(), rhs.to_csr(), Tool::num_of_worker()));
+    }
+    friend SparseMatrix<T> operator+(const SparseMatrix<T>& lhs, const SparseMatrix<T>& rhs) {
+        return FromCSR(SparseArithmetic::add(lhs.to_csr(), rhs.to_csr(), Tool::num_of_worker()));
+    }
+    friend SparseMatrix<T> operator-(const SparseMatrix<T>& lhs, const SparseMatrix<T>& rhs) {
+        return FromCSR(SparseArithmetic::subtract(lhs.to_csr(), rhs.to_csr(), Tool::num_of_worker()));
+    }
+
     /// @brief fast_transpose
     SparseMatrix<T> fast_transpose() {
         SparseMatrix<T> res;
@@ -229,6 +364,53 @@ public:
         return res;
     }
 
+    /// @brief @b parallel_transpose, `fast_transpose` split over threads:
+    /// per-thread col histograms of contiguous slices of `Data`, a prefix
+    /// sum in (col, thread) order, then each thread scatters its own slice
+    /// => same (stable) result as `fast_transpose`, no atomics
+    SparseMatrix<T> parallel_transpose(unsigned num_of_thread = Tool::num_of_worker()) const {
+        SparseMatrix<T> res;
+        res.Sizeof_Col = Sizeof_Row;
+        res.Sizeof_Row = Sizeof_Col;
+        res.Data       = std::vector<ElementInfo<T>>(Data.size());
+
+        const std::size_t num = Data.size();
+        num_of_thread         = static_cast<unsigned>(std::clamp<std::size_t>(num, 1, std::max(1u, num_of_thread)));
+        auto slice            = [&](unsigned worker_id) {
+            return std::pair { num * worker_id / num_of_thread, num * (worker_id + 1) / num_of_thread };
+        };
+
+        // location_table[thread][col] (col starts from 1)
+        std::vector<std::vector<std::size_t>> location_table(num_of_thread);
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& nums_table = location_table[worker_id];
+            nums_table.assign(Sizeof_Col + 1, 0);
+            auto [beg, end] = slice(worker_id);
+            for (std::size_t index = beg; index < end; ++index) {
+                ++nums_table[Data[index].Col];
+            }
+        });
+        std::size_t location = 0;
+        for (int col_index = 1; col_index <= Sizeof_Col; ++col_index) {
+            for (std::vector<std::size_t>& nums_table : location_table) {
+                std::size_t nums      = nums_table[col_index];
+                nums_table[col_index] = location;
+                location              += nums;
+            }
+        }
+
+        Tool::run_on_workers(num_of_thread, [&](unsigned worker_id) {
+            std::vector<std::size_t>& next = location_table[worker_id];
+            auto [beg, end]                = slice(worker_id);
+            for (std::size_t index = beg; index < end; ++index) {
+                ElementInfo<T>& curr = res.Data[next[Data[index].Col]++];
+                curr                 = Data[index];
+                curr.swap();
+            }
+        });
+        return res;
+    }
+
     /// @brief @b operator==
     friend bool operator==(const SparseMatrix<T>& lhs, const SparseMatrix<T>& rhs)
     requires std::equality_comparable<T>
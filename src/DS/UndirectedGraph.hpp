@@ -1,7 +1,7 @@
 /**
  * @file UndirectedGraph.hpp
  * @author Eden (edwardwang33773@gmail.com)
- * @brief BasicUndirectedGraph (Adjacency Matrix Ver.)
+ * @brief BasicUndirectedGraph (Adjacency Matrix Ver., one bit per entry)
  * @version 0.1
  * @date 2022-11-06
  *
@@ -11,12 +11,14 @@
 
 #pragma once
 
+#include "BitAdjacency.hpp"
+#include "FlatHashMap.hpp"
+
 #include <iostream>
 #include <ostream>
 #include <queue>
 #include <stdexcept>
 #include <tuple>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -26,18 +28,17 @@ namespace DS {
 template <typename T>
 class UndirectedGraph {
 public:
-    using UG         = UndirectedGraph<T>;
-    using MatType    = std::vector<std::vector<int>>;
-    using MatRowType = std::vector<int>;
+    using UG      = UndirectedGraph<T>;
+    using MatType = BitAdjacency;
 
     using ConstructList = std::vector<std::pair<T, T>>;
     using EdgeList      = std::vector<std::pair<T, T>>;
     using VertexList    = std::vector<T>;
 
 private:
-    std::vector<std::vector<int>> Mat;
-    std::unordered_map<T, int>    V_Index_Map;
-    std::unordered_map<int, T>    Index_V_Map;
+    BitAdjacency        Mat;         // symmetric
+    FlatHashMap<T, int> V_Index_Map; // name => index
+    std::vector<T>      Index_V_Map; // index => name
 
     int size = 0;
 
@@ -55,7 +56,7 @@ private:
         size        = std::move(moved.size);
     }
     void init_mat(const int& the_size) {
-        Mat = MatType(the_size, MatRowType(the_size, 0));
+        Mat = MatType(the_size);
     }
 
 public:
@@ -86,22 +87,19 @@ public:
     /// @b constructor
 public:
     explicit UndirectedGraph(const EdgeList& init) {
-        std::unordered_set<T> V_Set;
-        int                   num_of_V = 0;
+        int num_of_V = 0;
         // 1. build map, get num_of_V
         for (const std::pair<T, T>& V_pair : init) {
             const T& from = V_pair.first;
             const T& to   = V_pair.second;
-            if (!V_Set.contains(from)) {
-                V_Set.insert(from);
-                V_Index_Map[from]     = num_of_V;
-                Index_V_Map[num_of_V] = from;
+            if (!V_Index_Map.contains(from)) {
+                V_Index_Map[from] = num_of_V;
+                Index_V_Map.push_back(from);
                 ++num_of_V;
             }
-            if (!V_Set.contains(to)) {
-                V_Set.insert(to);
-                V_Index_Map[to]       = num_of_V;
-                Index_V_Map[num_of_V] = to;
+            if (!V_Index_Map.contains(to)) {
+                V_Index_Map[to] = num_of_V;
+                Index_V_Map.push_back(to);
                 ++num_of_V;
             }
         }
@@ -113,8 +111,8 @@ public:
             int first_idx  = V_Index_Map[V_pair.first];
             int second_idx = V_Index_Map[V_pair.second];
             // set => Mat[][] = 1
-            Mat[first_idx][second_idx] = 1;
-            Mat[second_idx][first_idx] = 1;
+            Mat.set(first_idx, second_idx);
+            Mat.set(second_idx, first_idx);
         }
     }
     explicit UndirectedGraph(
@@ -125,9 +123,11 @@ public:
         const int& num_of_v = VexInit.size();
         size                = num_of_v;
         int curr_idx        = 0;
+        V_Index_Map.reserve(VexInit.size());
+        Index_V_Map.reserve(VexInit.size());
         for (auto&& curr_vex : VexInit) {
             V_Index_Map[curr_vex] = curr_idx;
-            Index_V_Map[curr_idx] = curr_vex;
+            Index_V_Map.push_back(curr_vex);
             ++curr_idx;
         }
         // 2. init Mat
@@ -154,11 +154,8 @@ public:
     }
 
     int GetIndex(const T& v_name) {
-        int res = -1;
-        if (V_Index_Map.contains(v_name)) {
-            res = V_Index_Map[v_name];
-        }
-        return res;
+        const int* res = V_Index_Map.find(v_name);
+        return (res) ? *res : -1;
     }
     T GetVex(const int& index) {
         if (index < 0 || index >= size) {
@@ -171,14 +168,8 @@ public:
         if (!if_has_index(index)) {
             return -1;
         }
-        int index_ans = -1;
-        for (int col_idx = 0; col_idx < size; ++col_idx) {
-            if (Mat[index][col_idx]) {
-                index_ans = col_idx;
-                break;
-            }
-        }
-        return index_ans;
+        int index_ans = static_cast<int>(Mat.first_neighbor(index));
+        return (index_ans == size) ? -1 : index_ans;
     }
     int FindAdjIndex(const T& v_name) {
         if (!if_has_vex(v_name)) {
@@ -192,11 +183,8 @@ public:
         if (!if_has_index(index)) {
             return res;
         }
-        for (int col_idx = 0; col_idx < size; ++col_idx) {
-            if (Mat[index][col_idx]) {
-                res.push_back(col_idx);
-            }
-        }
+        res.reserve(Mat.degree(index));
+        Mat.for_each_neighbor(index, [&](std::size_t col_idx) { res.push_back(static_cast<int>(col_idx)); });
         return res;
     }
     std::vector<int> FindAllAdjIndex(const T& v_name) {
@@ -360,54 +348,46 @@ public:
             return;
         }
         // 1. update map
-        const int& curr_inserted_idx   = size;
-        V_Index_Map[NewVex]            = curr_inserted_idx;
-        Index_V_Map[curr_inserted_idx] = NewVex;
+        V_Index_Map[NewVex] = size;
+        Index_V_Map.push_back(NewVex);
         // 2. update size
         ++size;
         // 3. update Mat
-        Mat.resize(size);
-        for (std::vector<int>& row_vec : Mat) {
-            row_vec.push_back(0);
-        }
-        auto&& new_row = std::vector<int>(size, 0);
-        Mat.emplace_back(new_row);
+        Mat.push_vertex();
     }
     void DeleteVex(const T& DelVex) {
         if (!if_has_vex(DelVex)) {
             throw std::logic_error("Input Vertex is NOT exist!");
             // return;
         }
-        int DelIdx = V_Index_Map[DelVex];
-
-        MatType    NewMat;
-        MatRowType TempRow;
-        NewMat.reserve(size);
-        TempRow.reserve(size);
-        for (int row_idx = 0; row_idx < size; ++row_idx) {
-            if (row_idx == DelIdx) {
-                continue;
-            }
-            for (int col_idx = 0; col_idx < size; ++col_idx) {
-                if (col_idx == DelIdx) {
-                    continue;
-                }
-                TempRow.emplace_back(Mat[row_idx][col_idx]);
-            }
-            NewMat.emplace_back(TempRow);
-            TempRow.clear();
-        }
-
-        Mat = std::move(NewMat);
+        // move the last vertex into the hole => O(size), not a copy of Mat
+        const int del_idx  = V_Index_Map[DelVex];
+        const int last_idx = size - 1;
+        // 1. update Mat
+        Mat.swap_remove(del_idx);
+        // 2. update map
+        if (del_idx != last_idx) {
+            V_Index_Map[Index_V_Map[last_idx]] = del_idx;
+            Index_V_Map[del_idx]               = std::move(Index_V_Map[last_idx]);
+        }
+        V_Index_Map.erase(DelVex);
+        Index_V_Map.pop_back();
+        // 3. update size
+        --size;
     }
     void ArcOpt(const T& a_vex, const T& b_vex, bool if_delete = false) {
-        if (!if_has_vex(a_vex) || !if_has_vex(b_vex)) {
+        const int* a_ptr = V_Index_Map.find(a_vex);
+        const int* b_ptr = V_Index_Map.find(b_vex);
+        if (!a_ptr || !b_ptr) {
             throw std::logic_error("Undirected graph doesn't contain all of input vertexes!");
         }
-        int a_idx         = V_Index_Map[a_vex];
-        int b_idx         = V_Index_Map[b_vex];
-        Mat[a_idx][b_idx] = (if_delete) ? 0 : 1;
-        Mat[b_idx][a_idx] = (if_delete) ? 0 : 1;
+        if (if_delete) {
+            Mat.reset(*a_ptr, *b_ptr);
+            Mat.reset(*b_ptr, *a_ptr);
+        } else {
+            Mat.set(*a_ptr, *b_ptr);
+            Mat.set(*b_ptr, *a_ptr);
+        }
     }
     void InsertArc(const T& a_vex, const T& b_vex) {
         ArcOpt(a_vex, b_vex);
@@ -415,6 +395,32 @@ public:
     void DeleteArc(const T& a_vex, const T& b_vex) {
         ArcOpt(a_vex, b_vex, true);
     }
+
+public:
+    /// @brief @b bit_parallel_queries
+    int GetDegree(const T& v_name) {
+        if (!if_has_vex(v_name)) {
+            throw std::logic_error("Input vertex is NOT exist!");
+        }
+        return static_cast<int>(Mat.degree(GetIndex(v_name)));
+    }
+    /// @brief number of common neighbours of the two vertexes
+    int CountCommonAdj(const T& a_vex, const T& b_vex) {
+        if (!if_has_vex(a_vex) || !if_has_vex(b_vex)) {
+            throw std::logic_error("Undirected graph doesn't contain all of input vertexes!");
+        }
+        return static_cast<int>(Mat.intersect_count(GetIndex(a_vex), GetIndex(b_vex)));
+    }
+    long long CountTriangles() {
+        return static_cast<long long>(Mat.count_triangles());
+    }
+    /// @brief @b GetHopDist => edges from `source` to every index, -1 if unreachable
+    std::vector<int> GetHopDist(const T& source) {
+        if (!if_has_vex(source)) {
+            throw std::logic_error("Input vertex is NOT exist!");
+        }
+        return Mat.hop_dist(GetIndex(source));
+    }
 };
 
 } // namespace DS
\ No newline at end of file
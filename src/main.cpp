@@ -9,6 +9,7 @@
  *
  */
 
+#include "../bench/BenchIter.hpp"
 #include "../test/TestIter.hpp"
 // #include "Problem/CountOff.hpp"
 // #include "Problem/N_Queen.hpp"
@@ -16,6 +17,7 @@
 
 int main(int argc, char** argv) {
     Test::run_all_test();
+    // Bench::run_all_bench();
     // CountOff_Solution_Generator::Solution();
     // N_Queen::solution();
     // SaddlePoint::TestInterface();
@@ -0,0 +1,79 @@
+/**
+ * @file AdaptiveHuffmanTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief AdaptiveHuffmanTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/AdaptiveHuffman.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace Test {
+
+void AdaptiveHuffmanTest() {
+    Tool::title_info("Adaptive_Huffman");
+
+    auto round_trip = [](const std::vector<std::uint8_t>& data, std::uint32_t weight_limit) {
+        std::vector<std::uint8_t> compressed;
+        DS::AdaptiveHuffmanEncoder encoder(compressed, weight_limit);
+        // streamed in uneven chunks
+        std::span<const std::uint8_t> rest(data);
+        for (std::size_t chunk = 1; !rest.empty(); chunk = chunk * 3 + 1) {
+            std::size_t size = std::min(chunk, rest.size());
+            encoder.encode(rest.first(size));
+            rest = rest.subspan(size);
+        }
+        encoder.finish();
+
+        std::vector<std::uint8_t>  restored;
+        DS::AdaptiveHuffmanDecoder decoder(weight_limit);
+        decoder.decode(compressed, restored);
+        assert(restored == data);
+        return compressed.size();
+    };
+
+    std::mt19937              gen(33773);
+    std::vector<std::uint8_t> text;
+    for (int i = 0; i < 100'000; ++i) {
+        int symbol = 0;
+        while (symbol < 40 && gen() % 2 == 0) {
+            ++symbol;
+        }
+        text.push_back(static_cast<std::uint8_t>('a' + symbol));
+    }
+    std::vector<std::uint8_t> all_bytes;
+    for (int round = 0; round < 20; ++round) {
+        for (int byte = 0; byte < 256; ++byte) {
+            all_bytes.push_back(static_cast<std::uint8_t>(byte * 7 + round));
+        }
+    }
+
+    round_trip({}, DS::AdaptiveHuffmanTree::DefaultWeightLimit);
+    round_trip({ 'x' }, DS::AdaptiveHuffmanTree::DefaultWeightLimit);
+    round_trip(all_bytes, DS::AdaptiveHuffmanTree::DefaultWeightLimit);
+    // tiny limit => the model is reset over and over
+    round_trip(all_bytes, 100);
+    round_trip(text, 64);
+    std::size_t text_size = round_trip(text, DS::AdaptiveHuffmanTree::DefaultWeightLimit);
+    assert(text_size < text.size() / 2);
+
+    std::cout << "text : " << text.size() << " bytes => " << text_size << " bytes" << std::endl;
+    std::cout << std::endl;
+
+    Tool::end_info("Adaptive_Huffman");
+}
+
+} // namespace Test
@@ -0,0 +1,84 @@
+/**
+ * @file ArenaBinaryTreeTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief ArenaBinaryTreeTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/ArenaBinaryTree.hpp"
+#include "../../src/DS/BinaryTree.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace Test {
+
+void ArenaBinaryTreeTest() {
+    Tool::title_info("Arena_Binary_Tree");
+
+    using Arena = DS::ArenaBinaryTree<int>;
+
+    std::vector<std::string> level_order {
+        "1", "2", "3",
+        "4", "#", "6",
+        "7", "#", "8"
+    };
+
+    // 1. same shape as the pointer based BinaryTree
+    {
+        Arena arena = Arena::CreateBiTree(level_order);
+        auto  tree  = DS::BinaryTree<int>::CreateBiTree(level_order);
+        Arena from  = Arena::FromBinaryTree(tree);
+
+        std::vector<int> lhs, rhs;
+        arena.InOrderOpt([&](Arena::Index idx) { lhs.push_back(arena.Value(idx)); });
+        from.InOrderOpt([&](Arena::Index idx) { rhs.push_back(from.Value(idx)); });
+        assert(lhs == rhs);
+        assert(arena.BiTreeSize() == 7 && arena.BiTreeDepth() == 4);
+
+        arena.PreOrderTraverse();
+        std::cout << std::endl;
+        arena.InOrderTraverse();
+        std::cout << std::endl;
+        arena.PostOrderTraverse();
+        std::cout << std::endl;
+        arena.LevelOrderTraverse();
+        std::cout << std::endl;
+    }
+
+    // 2. O(1) parent, delete & reuse & compact
+    {
+        Arena        arena = Arena::CreateBiTree(level_order);
+        Arena::Index root  = arena.Root();
+        Arena::Index two   = arena.LeftChild(root);
+        Arena::Index three = arena.RightChild(root);
+        assert(arena.Parent(two) == root && arena.Parent(root) == Arena::Null);
+        assert(arena.RightBrother(two) == three && arena.LeftBrother(three) == two);
+
+        arena.DeleteChild(root, 1); // drop 3, 6, 7
+        assert(arena.BiTreeSize() == 4);
+        Arena::Index five = arena.InsertChild(two, 5, 1);
+        assert(arena.Parent(five) == two && arena.Value(five) == 5);
+
+        arena.Compact();
+        std::vector<int> pre_order;
+        arena.PreOrderOpt([&](Arena::Index idx) { pre_order.push_back(arena.Value(idx)); });
+        assert((pre_order == std::vector<int> { 1, 2, 4, 8, 5 }));
+        arena.LevelOrderTraverse();
+        std::cout << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    Tool::end_info("Arena_Binary_Tree");
+}
+
+} // namespace Test
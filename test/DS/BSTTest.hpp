@@ -14,6 +14,12 @@
 #include "../../src/DS/BST.hpp"
 #include "../../tools/TestTool.hpp"
 
+#include <cassert>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
 namespace Test {
 
 void BSTTest() {
@@ -46,6 +52,69 @@ void BSTTest() {
 
     std::cout << std::endl;
 
+    // bulk construction & bulk merge
+    {
+        std::vector<int> evens, threes;
+        for (int i = 0; i < 30; i += 2) {
+            evens.push_back(i);
+        }
+        for (int i = 0; i < 30; i += 3) {
+            threes.push_back(i);
+        }
+        auto lhs = DS::BST<int>::from_sorted(evens);
+        auto rhs = DS::BST<int>::from_sorted(threes);
+        assert(lhs.get_size() == 15 && lhs.contains(28) && !lhs.contains(27));
+
+        auto merged = DS::BST<int>::set_union(lhs, rhs);
+        auto common = DS::BST<int>::set_intersection(lhs, rhs);
+        merged.print_tree(); // 0 2 3 4 6 8 9 10 12 ...
+        common.print_tree(); // 0 6 12 18 24
+
+        std::vector<int> common_expected { 0, 6, 12, 18, 24 };
+        assert(common.to_sorted_vector() == common_expected);
+
+        // pooled nodes & heap nodes could be mixed
+        merged.insert(100);
+        merged.remove(9);
+        merged.remove(100);
+        assert(!merged.contains(9) && merged.get_size() == 19);
+    }
+
+    // order statistics & range aggregate, compared with std::set
+    {
+        DS::BST<int>  tree;
+        std::set<int> expected;
+        std::mt19937  gen(33773);
+        for (int round = 0; round < 4000; ++round) {
+            int val = static_cast<int>(gen() % 500);
+            if (gen() % 3) {
+                tree.insert(val);
+                expected.insert(val);
+            } else {
+                tree.remove(val); // includes removing the root
+                expected.erase(val);
+            }
+        }
+        std::vector<int> sorted(expected.begin(), expected.end());
+        assert(tree.get_size() == static_cast<int>(sorted.size()));
+        for (int k = 0; k < static_cast<int>(sorted.size()); ++k) {
+            assert(tree.select(k) == sorted[k]);
+            assert(tree.rank(sorted[k]) == k);
+        }
+        for (int lo = -10; lo < 510; lo += 37) {
+            for (int hi = lo; hi < 520; hi += 53) {
+                auto      beg = expected.lower_bound(lo);
+                auto      end = expected.upper_bound(hi);
+                long long sum = std::accumulate(beg, end, 0LL);
+                assert(tree.range_count(lo, hi) == std::distance(beg, end));
+                assert(tree.range_sum(lo, hi) == sum);
+            }
+        }
+        std::cout << "median => " << tree.select(tree.get_size() / 2) << std::endl;
+    }
+
+    std::cout << std::endl;
+
     Tool::end_info("Binary_Search_Tree");
 }
 
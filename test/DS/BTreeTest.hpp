@@ -0,0 +1,94 @@
+/**
+ * @file BTreeTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief BTreeTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BTree.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Test {
+
+void BTreeTest() {
+    Tool::title_info("B+_Tree");
+
+    // random insert, compared with std::map
+    {
+        DS::BTree<int, int, 4> tree; // tiny fanout => many splits
+        std::map<int, int>     expected;
+        std::mt19937           gen(33773);
+        for (int i = 0; i < 5000; ++i) {
+            int key = static_cast<int>(gen() % 2000) - 1000;
+            tree.insert(key, i);
+            expected[key] = i;
+        }
+        assert(tree.get_size() == static_cast<int>(expected.size()));
+        for (int key = -1100; key < 1100; ++key) {
+            const int* found = tree.find(key);
+            assert((found != nullptr) == expected.contains(key));
+            assert(!found || *found == expected[key]);
+        }
+        std::vector<std::pair<int, int>> scanned;
+        tree.range_scan(-10, 10, [&](int key, int value) {
+            scanned.emplace_back(key, value);
+        });
+        std::vector<std::pair<int, int>> scanned_expected(
+            expected.lower_bound(-10), expected.upper_bound(10)
+        );
+        assert(scanned == scanned_expected);
+    }
+    // bulk load, then keep inserting
+    {
+        std::vector<std::pair<int, std::string>> sorted;
+        for (int i = 0; i < 1000; ++i) {
+            sorted.emplace_back(i * 2, std::to_string(i * 2));
+        }
+        auto tree = DS::BTree<int, std::string>::from_sorted(sorted);
+        assert(tree.get_size() == 1000);
+        assert(tree.contains(998) && !tree.contains(999));
+        for (int i = 0; i < 1000; ++i) {
+            tree.insert(i * 2 + 1, std::to_string(i * 2 + 1));
+        }
+        int prev  = -1;
+        int count = 0;
+        tree.for_each([&](int key, const std::string& value) {
+            assert(key == prev + 1 && value == std::to_string(key));
+            prev = key;
+            ++count;
+        });
+        assert(count == 2000);
+    }
+    // small demo
+    {
+        DS::BTree<std::string, int> tree;
+        for (auto&& word : { "delta", "alpha", "echo", "charlie", "bravo" }) {
+            tree.insert(word, static_cast<int>(std::string(word).size()));
+        }
+        tree.print_tree();
+        tree.range_scan("b", "d", [](const std::string& key, int) {
+            std::cout << key << " ";
+        });
+        std::cout << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    Tool::end_info("B+_Tree");
+}
+
+} // namespace Test
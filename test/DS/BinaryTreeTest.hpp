@@ -10,9 +10,16 @@
  */
 
 #pragma once
+#include "../../src/DS/BST.hpp"
 #include "../../src/DS/BinaryTree.hpp"
 #include "../../tools/TestTool.hpp"
+#include <cassert>
+#include <cstdint>
 #include <ios>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 namespace Test {
 
@@ -58,10 +65,166 @@ void first_test() {
     std::cout << std::endl;
 }
 
+void wire_format_test() {
+    DS::BinaryTree<int> BiTree = DS::BinaryTree<int>::CreateBiTree(
+        std::vector<std::string> {
+            "1", "-2", "3",
+            "#", "500", "-600", "#",
+            "7" }
+    );
+
+    // buffer round trip
+    std::vector<std::uint8_t> buffer;
+    BiTree.SerializeToBuffer(buffer);
+    auto BiTree_loaded = DS::BinaryTree<int>::DeserializeFromBuffer(buffer);
+    assert(BiTree_loaded == BiTree);
+    assert(BiTree_loaded.BiTreeSize() == BiTree.BiTreeSize());
+
+    // stream round trip
+    std::stringstream stream;
+    BiTree.SerializeToStream(stream);
+    auto BiTree_streamed = DS::BinaryTree<int>::DeserializeFromStream(stream);
+    assert(BiTree_streamed == BiTree);
+
+    // structural copy & equality
+    DS::BinaryTree<int> BiTree_copied = BiTree;
+    assert(BiTree_copied == BiTree);
+    BiTree_copied.emplace_unselect([](int a) -> bool { return a == 500; });
+    assert(BiTree_copied != BiTree);
+    BiTree_copied = BiTree;
+    assert(DS::BinaryTree<int>::IfSame(BiTree_copied, BiTree));
+
+    // empty tree & truncated buffer
+    DS::BinaryTree<int> empty_tree = DS::BinaryTree<int>::CreateBiTree({});
+    buffer.clear();
+    empty_tree.SerializeToBuffer(buffer);
+    assert(DS::BinaryTree<int>::DeserializeFromBuffer(buffer).BiTreeEmpty());
+    buffer.clear();
+    BiTree.SerializeToBuffer(buffer);
+    buffer.pop_back();
+    bool if_thrown = false;
+    try {
+        DS::BinaryTree<int>::DeserializeFromBuffer(buffer);
+    } catch (const std::runtime_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // untrusted node count (2^63 => the bitmap size would wrap), trailing
+    // bytes after the last elem, an empty tree followed by garbage
+    std::vector<std::uint8_t> valid;
+    BiTree.SerializeToBuffer(valid);
+    std::vector<std::vector<std::uint8_t>> broken_buffers {
+        { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xFF, 0x00, 0x02 },
+        valid,
+        { 0x00, 0x07 },
+    };
+    broken_buffers[1].push_back(0x00);
+    for (const auto& broken : broken_buffers) {
+        if_thrown = false;
+        try {
+            DS::BinaryTree<int>::DeserializeFromBuffer(broken);
+        } catch (const std::runtime_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+
+    std::cout << "Wire format round trip => "
+              << buffer.size() + 1 << " bytes for "
+              << BiTree.BiTreeSize() << " nodes"
+              << std::endl;
+    std::cout << std::endl;
+}
+
+void traverse_engine_test() {
+    DS::BinaryTree<int> BiTree = DS::BinaryTree<int>::CreateBiTree(
+        std::vector<std::string> {
+            "1", "2", "3",
+            "4", "5", "#", "6",
+            "#", "7", "8" }
+    );
+    DS::BinaryTree<int> BiTree_before = BiTree;
+
+    std::vector<int> iterative;
+    std::vector<int> recursive;
+    std::vector<int> morris;
+    auto             collect_to = [&](std::vector<int>& out) {
+        return [&](auto* node) { out.push_back(BiTree.Value(node)); };
+    };
+
+    BiTree.PreOrderOpt(collect_to(iterative));
+    BiTree.PreOrderOpt_Rec(collect_to(recursive));
+    BiTree.MorrisPreOrderOpt(collect_to(morris));
+    assert(iterative == (std::vector<int> { 1, 2, 4, 7, 5, 8, 3, 6 }));
+    assert(recursive == iterative && morris == iterative);
+
+    iterative.clear();
+    recursive.clear();
+    morris.clear();
+    BiTree.InOrderOpt(collect_to(iterative));
+    BiTree.InOrderOpt_Rec(collect_to(recursive));
+    BiTree.MorrisInOrderOpt(collect_to(morris));
+    assert(iterative == (std::vector<int> { 4, 7, 2, 8, 5, 1, 3, 6 }));
+    assert(recursive == iterative && morris == iterative);
+
+    // Morris must restore every borrowed link
+    assert(BiTree == BiTree_before);
+}
+
+void parallel_fold_test() {
+    std::vector<std::string> data;
+    std::mt19937             gen(33773);
+    for (int i = 0; i < 5000; ++i) {
+        data.push_back((gen() % 8 == 0) ? "#" : std::to_string(static_cast<int>(gen() % 1000) - 500));
+    }
+    DS::BinaryTree<int> BiTree = DS::BinaryTree<int>::CreateBiTree(data);
+
+    for (int cutoff : { 0, 1, 3, 6 }) {
+        long long sum = 0;
+        BiTree.InOrderOpt([&](auto* node) { sum += BiTree.Value(node); });
+        assert(BiTree.ParallelReduce<DS::SumMonoid<int>>(cutoff) == sum);
+        assert(BiTree.BiTreeSize_Parallel(cutoff) == BiTree.BiTreeSize());
+        assert(BiTree.BiTreeDepth_Parallel(cutoff) == BiTree.BiTreeDepth());
+        assert(BiTree.BiTreeBreadth_Parallel(cutoff) == BiTree.BiTreeBreadth());
+    }
+
+    // right skewed chain => one node per level, the breadth fold stays linear
+    std::vector<std::string> chain_data;
+    for (int i = 0; i < 100'000; ++i) {
+        chain_data.push_back(std::to_string(i));
+        chain_data.push_back("#");
+    }
+    DS::BinaryTree<int> chain = DS::BinaryTree<int>::CreateBiTree(chain_data);
+    assert(chain.BiTreeDepth_Parallel(3) == 100'000);
+    assert(chain.BiTreeBreadth_Parallel(3) == 1 && chain.BiTreeBreadth() == 1);
+
+    // only the complete one passes
+    DS::BinaryTree<int> complete = DS::BinaryTree<int>::CreateBiTree(
+        std::vector<std::string> { "1", "2", "3", "4", "5", "6" }
+    );
+    DS::BinaryTree<int> incomplete = DS::BinaryTree<int>::CreateBiTree(
+        std::vector<std::string> { "1", "2", "3", "4", "#", "6" }
+    );
+    assert(complete.IfCompleteBiTree_Parallel(1));
+    assert(!incomplete.IfCompleteBiTree_Parallel(1));
+
+    // same result as the sequential filter
+    DS::BinaryTree<int> filtered          = BiTree;
+    DS::BinaryTree<int> filtered_parallel = BiTree;
+    filtered.emplace_select([](int a) -> bool { return a % 7 != 0; });
+    filtered_parallel.emplace_filter_parallel([](int a) { return a % 7 != 0; }, false, 3);
+    assert(filtered == filtered_parallel);
+    assert(filtered_parallel.BiTreeSize() == filtered_parallel.BiTreeSize_Parallel());
+}
+
 void BinaryTreeTest() {
     Tool::title_info("Binary_Tree");
 
     first_test();
+    wire_format_test();
+    traverse_engine_test();
+    parallel_fold_test();
 
     Tool::end_info("Binary_Tree");
 }
@@ -0,0 +1,145 @@
+/**
+ * @file BitAdjacencyTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief BitAdjacencyTest, bit queries against a naive bool matrix
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include "../../src/DS/BitAdjacency.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace Test {
+
+/// @brief degree, neighbours, common neighbours, triangles and hop distances
+/// of `bits` agree with the symmetric `naive`
+void check_bit_adjacency(const DS::BitAdjacency& bits, const std::vector<std::vector<bool>>& naive) {
+    const std::size_t num = naive.size();
+    assert(bits.size() == num);
+    for (std::size_t row = 0; row < num; ++row) {
+        std::vector<std::size_t> expected;
+        for (std::size_t col = 0; col < num; ++col) {
+            assert(bits.test(row, col) == naive[row][col]);
+            if (naive[row][col]) {
+                expected.push_back(col);
+            }
+        }
+        std::vector<std::size_t> found;
+        bits.for_each_neighbor(row, [&](std::size_t col) { found.push_back(col); });
+        assert(found == expected && bits.degree(row) == expected.size());
+        assert(bits.first_neighbor(row) == (expected.empty() ? num : expected.front()));
+    }
+    std::size_t triangles = 0;
+    for (std::size_t a = 0; a < num; ++a) {
+        for (std::size_t b = a + 1; b < num; ++b) {
+            std::size_t common = 0;
+            for (std::size_t c = 0; c < num; ++c) {
+                common    += naive[a][c] && naive[b][c];
+                triangles += c > b && naive[a][b] && naive[a][c] && naive[b][c];
+            }
+            assert(bits.intersect_count(a, b) == common);
+        }
+    }
+    assert(bits.count_triangles() == triangles);
+    for (std::size_t source = 0; source < num; source += 7) {
+        std::vector<int>        dist(num, -1);
+        std::queue<std::size_t> index_queue;
+        dist[source] = 0;
+        index_queue.push(source);
+        while (!index_queue.empty()) {
+            std::size_t curr = index_queue.front();
+            index_queue.pop();
+            for (std::size_t col = 0; col < num; ++col) {
+                if (naive[curr][col] && dist[col] == -1) {
+                    dist[col] = dist[curr] + 1;
+                    index_queue.push(col);
+                }
+            }
+        }
+        assert(bits.hop_dist(source) == dist);
+    }
+}
+void BitAdjacencyTest() {
+    Tool::title_info("Bit_Adjacency");
+
+    // grow across several word boundaries, churn, shrink back below one word
+    DS::BitAdjacency               bits;
+    std::vector<std::vector<bool>> naive;
+    std::mt19937                   gen(33773);
+    auto                           push_vertex = [&] {
+        bits.push_vertex();
+        for (auto& row : naive) {
+            row.push_back(false);
+        }
+        naive.emplace_back(naive.size() + 1, false);
+    };
+    auto swap_remove = [&](std::size_t idx) {
+        bits.swap_remove(idx);
+        std::size_t last = naive.size() - 1;
+        for (auto& row : naive) {
+            row[idx] = row[last];
+            row.pop_back();
+        }
+        naive[idx] = naive[last];
+        naive.pop_back();
+    };
+    auto set_edge = [&](std::size_t a, std::size_t b, bool value) {
+        if (value) {
+            bits.set(a, b);
+            bits.set(b, a);
+        } else {
+            bits.reset(a, b);
+            bits.reset(b, a);
+        }
+        naive[a][b] = value;
+        naive[b][a] = value;
+    };
+    for (int round = 0; round < 3; ++round) {
+        while (naive.size() < 150) {
+            push_vertex();
+            for (int idx = 0; idx < 4; ++idx) {
+                set_edge(naive.size() - 1, gen() % naive.size(), true);
+            }
+        }
+        for (int step = 0; step < 500; ++step) {
+            set_edge(gen() % naive.size(), gen() % naive.size(), gen() % 3 != 0);
+        }
+        check_bit_adjacency(bits, naive);
+        while (naive.size() > 40) {
+            swap_remove(gen() % naive.size());
+        }
+        check_bit_adjacency(bits, naive);
+    }
+    while (!naive.empty()) {
+        swap_remove(0);
+    }
+    assert(bits.size() == 0);
+
+    // a complete graph on n vertexes => C(n, 3) triangles, every hop is 1
+    DS::BitAdjacency complete(100);
+    for (std::size_t a = 0; a < 100; ++a) {
+        for (std::size_t b = 0; b < 100; ++b) {
+            if (a != b) {
+                complete.set(a, b);
+            }
+        }
+    }
+    assert(complete.count_triangles() == 100 * 99 * 98 / 6);
+    assert(complete.degree(64) == 99 && complete.get_num_of_word() == 2);
+    std::vector<int> hops = complete.hop_dist(99);
+    assert(hops[99] == 0 && hops[0] == 1 && hops[63] == 1);
+
+    Tool::end_info("Bit_Adjacency");
+}
+
+} // namespace Test
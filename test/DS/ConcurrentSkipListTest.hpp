@@ -0,0 +1,130 @@
+/**
+ * @file ConcurrentSkipListTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief ConcurrentSkipListTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/ConcurrentSkipList.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+void ConcurrentSkipListTest() {
+    Tool::title_info("Concurrent_Skip_List");
+
+    constexpr int NumOfThread = 8;
+    constexpr int PerThread   = 2000;
+
+    DS::ConcurrentSkipList<int> list;
+
+    // 1. concurrent insert (interleaved keys, with duplicates)
+    {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < NumOfThread; ++t) {
+            workers.emplace_back([&list, t] {
+                for (int i = 0; i < PerThread; ++i) {
+                    list.insert(i * NumOfThread + t);
+                    list.insert(i * NumOfThread + (t + 1) % NumOfThread);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    assert(list.get_size() == NumOfThread * PerThread);
+
+    // 2. concurrent remove of odd keys, while readers keep scanning
+    {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < NumOfThread; ++t) {
+            workers.emplace_back([&list, t] {
+                for (int key = t; key < NumOfThread * PerThread; key += NumOfThread) {
+                    if (key % 2) {
+                        list.remove(key);
+                    }
+                }
+            });
+            workers.emplace_back([&list] {
+                int prev = -1;
+                list.for_each_in_range(0, NumOfThread * PerThread, [&prev](int key) {
+                    assert(prev < key); // always ascending
+                    prev = key;
+                });
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    assert(list.get_size() == NumOfThread * PerThread / 2);
+    for (int key = 0; key < NumOfThread * PerThread; ++key) {
+        assert(list.contains(key) == (key % 2 == 0));
+    }
+
+    // 3. nested guards => `contains` / `remove` from a `for_each` callback,
+    // while other threads retire nodes under the traversal
+    {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < NumOfThread; ++t) {
+            workers.emplace_back([&list, t] {
+                for (int key = t * 4; key < NumOfThread * PerThread; key += NumOfThread * 4) {
+                    list.remove(key);
+                }
+            });
+        }
+        workers.emplace_back([&list] {
+            list.for_each([&list](int key) {
+                assert(key % 2 == 0);
+                list.contains(key + 2);
+                if (key % 8 == 2) {
+                    assert(list.remove(key));
+                }
+            });
+        });
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    for (int key = 0; key < NumOfThread * PerThread; ++key) {
+        assert(list.contains(key) == (key % 8 == 6));
+    }
+    // the callback retires the node the traversal stands on, then enough
+    // others to advance the epoch => it must stay alive until `for_each` ends
+    {
+        DS::ConcurrentSkipList<int> nested;
+        for (int key = 0; key < 1000; ++key) {
+            nested.insert(key);
+        }
+        nested.for_each([&nested](int key) {
+            if (key == 0) {
+                for (int del = 0; del < 600; ++del) {
+                    nested.remove(del);
+                }
+            }
+        });
+        assert(nested.get_size() == 400 && !nested.contains(0) && nested.contains(600));
+    }
+
+    list.for_each_in_range(100, 120, [](int key) {
+        std::cout << key << " ";
+    });
+    std::cout << std::endl;
+
+    std::cout << std::endl;
+
+    Tool::end_info("Concurrent_Skip_List");
+}
+
+} // namespace Test
@@ -0,0 +1,82 @@
+/**
+ * @file FlatHashMapTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief FlatHashMapTest, random operations against std::unordered_map
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include "../../src/DS/FlatHashMap.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace Test {
+
+void FlatHashMapTest() {
+    Tool::title_info("Flat_Hash_Map");
+
+    // random churn on a small key range => many tombstones and rehashes
+    {
+        DS::FlatHashMap<int, int>    map;
+        std::unordered_map<int, int> expected;
+        std::mt19937                 gen(33773);
+        for (int step = 0; step < 200'000; ++step) {
+            int key = static_cast<int>(gen() % 5000) - 2500;
+            switch (gen() % 4) {
+            case 0:
+                assert(map.erase(key) == (expected.erase(key) == 1));
+                break;
+            case 1:
+                assert(map.insert_or_assign(key, step) == !expected.contains(key));
+                expected[key] = step;
+                break;
+            case 2:
+                map[key] += 1;
+                expected[key] += 1;
+                break;
+            default:
+                const int* found = map.find(key);
+                assert((found != nullptr) == expected.contains(key));
+                assert(!found || *found == expected[key]);
+            }
+            assert(map.size() == expected.size());
+        }
+        for (auto&& [key, value] : expected) {
+            assert(map.at(key) == value);
+        }
+    }
+    // strings, reserve, clear, at
+    {
+        DS::FlatHashMap<std::string, int> map;
+        map.reserve(1000);
+        for (int idx = 0; idx < 1000; ++idx) {
+            map["vertex_" + std::to_string(idx)] = idx;
+        }
+        assert(map.size() == 1000 && map.at("vertex_999") == 999 && !map.contains("vertex_1000"));
+        bool if_thrown = false;
+        try {
+            map.at("missing");
+        } catch (const std::out_of_range&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+        auto copied = map;
+        map.clear();
+        assert(map.empty() && !map.contains("vertex_0") && copied.at("vertex_0") == 0);
+        map["again"] = 1;
+        assert(map.size() == 1 && map.at("again") == 1);
+    }
+
+    Tool::end_info("Flat_Hash_Map");
+}
+
+} // namespace Test
@@ -0,0 +1,149 @@
+/**
+ * @file GraphSnapshotTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief GraphSnapshotTest, save => map round trips and broken files
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include "../../src/DS/GraphSnapshot.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Test {
+
+/// @brief the snapshot has the vertexes, names, arcs and weights of `graph`
+template <typename T>
+void check_snapshot(DS::Graph<T>& graph, const DS::GraphSnapshot& snapshot, bool if_weighted) {
+    snapshot.check_all();
+    assert(snapshot.get_vex_num() == static_cast<std::size_t>(graph.GetVexNum()));
+    assert(snapshot.if_weighted() == if_weighted);
+    std::size_t num_of_arc = 0;
+    for (int idx = 0; idx < graph.GetVexNum(); ++idx) {
+        const T vex = graph.GetVex(idx);
+        assert(snapshot.find(std::string(snapshot.name(idx))) == idx);
+
+        std::vector<int> expected = graph.FindAllAdjIndex(vex);
+        auto             found    = snapshot.neighbors(idx);
+        assert(std::vector<int>(found.begin(), found.end()) == expected);
+        assert(snapshot.degree(idx) == expected.size());
+        for (int to : expected) {
+            int weight = (if_weighted) ? graph.get_low_cost_of(vex, graph.GetVex(to)) : 1;
+            assert(snapshot.get_weight(idx, to) == weight);
+        }
+        num_of_arc += expected.size();
+    }
+    assert(snapshot.get_arc_num() == num_of_arc);
+}
+/// @brief `snapshot_path` rewritten with `byte` at `pos`, or cut to `pos`
+void corrupt_snapshot(const std::string& snapshot_path, std::size_t pos, int byte) {
+    std::string bytes;
+    {
+        std::ifstream in(snapshot_path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    if (byte < 0) {
+        bytes.resize(pos);
+    } else {
+        bytes[pos] = static_cast<char>(byte);
+    }
+    std::ofstream(snapshot_path, std::ios::binary | std::ios::trunc) << bytes;
+}
+bool if_snapshot_throws(const std::string& snapshot_path) {
+    try {
+        DS::GraphSnapshot snapshot(snapshot_path);
+        snapshot.check_all();
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+void GraphSnapshotTest() {
+    Tool::title_info("Graph_Snapshot");
+
+    const std::string path = "graph_snapshot_test.bin";
+
+    // random weighted directed graph, with deletes => holes renamed
+    {
+        std::mt19937     gen(33773);
+        std::vector<int> vexes(300);
+        for (int idx = 0; idx < 300; ++idx) {
+            vexes[idx] = idx * 7 - 500;
+        }
+        DS::Graph<int> graph(vexes, DS::Graph<int>::WEdgeList {}, true);
+        for (int step = 0; step < 3000; ++step) {
+            graph.InsertArc(vexes[gen() % 300], vexes[gen() % 300], static_cast<int>(gen() % 50) - 10);
+        }
+        for (int idx = 0; idx < 300; idx += 9) {
+            graph.DeleteVex(vexes[idx]);
+        }
+        DS::GraphSnapshot::save(path, graph);
+        DS::GraphSnapshot snapshot(path);
+        assert(snapshot.if_directed());
+        check_snapshot(graph, snapshot, true);
+        assert(snapshot.find("-500") == -1 && snapshot.find("-493") == graph.GetIndex(-493));
+    }
+    // string names, undirected, unweighted in both storages
+    for (bool if_bitset : { false, true }) {
+        using StrGraph = DS::Graph<std::string>;
+        StrGraph graph(
+            StrGraph::VertexList { "a", "bb", "", "ccc", "d" },
+            StrGraph::EdgeList { { "a", "bb" }, { "bb", "" }, { "a", "a" }, { "ccc", "a" } },
+            false,
+            if_bitset
+        );
+        DS::GraphSnapshot::save(path, graph);
+        DS::GraphSnapshot moved(path);
+        DS::GraphSnapshot snapshot = std::move(moved);
+        assert(!snapshot.if_directed() && snapshot.weights(0).empty());
+        check_snapshot(graph, snapshot, false);
+        assert(snapshot.find("") == 2 && snapshot.find("b") == -1 && snapshot.degree(4) == 0);
+    }
+    // empty graph
+    {
+        DS::Graph<int> graph(std::vector<int> {}, DS::Graph<int>::EdgeList {});
+        DS::GraphSnapshot::save(path, graph);
+        DS::GraphSnapshot snapshot(path);
+        assert(snapshot.get_vex_num() == 0 && snapshot.get_arc_num() == 0 && snapshot.find("0") == -1);
+    }
+    // broken files => magic, version, truncation, an index out of range
+    {
+        DS::Graph<int> graph(std::vector<int> { 1, 2, 3 }, DS::Graph<int>::EdgeList { { 1, 2 }, { 2, 3 } });
+        auto           rewrite = [&] {
+            DS::GraphSnapshot::save(path, graph);
+            assert(!if_snapshot_throws(path));
+        };
+        rewrite();
+        corrupt_snapshot(path, 0, 'X');
+        assert(if_snapshot_throws(path));
+        rewrite();
+        corrupt_snapshot(path, offsetof(DS::GraphSnapshot::Header, version), 2);
+        assert(if_snapshot_throws(path));
+        rewrite();
+        corrupt_snapshot(path, DS::GraphSnapshot(path).get_header().file_size - 1, -1);
+        assert(if_snapshot_throws(path));
+        rewrite();
+        corrupt_snapshot(path, DS::GraphSnapshot(path).get_header().neighbors_at, 9);
+        assert(if_snapshot_throws(path));
+        corrupt_snapshot(path, 10, -1);
+        assert(if_snapshot_throws(path));
+    }
+    std::remove(path.c_str());
+
+    Tool::end_info("Graph_Snapshot");
+}
+
+} // namespace Test
@@ -0,0 +1,174 @@
+/**
+ * @file GraphTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief GraphTest, dynamic vertex / arc updates against a naive reference
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include "../../src/DS/Graph.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Test {
+
+/// @brief every name <=> index pair and every cost agree with `arcs`
+/// (the directed arcs of the reference, both halves if undirected)
+void check_graph(
+    DS::Graph<int>&                           graph,
+    const std::vector<int>&                   vexes,
+    const std::map<std::pair<int, int>, int>& arcs,
+    bool                                      if_weighted
+) {
+    assert(graph.GetVexNum() == static_cast<int>(vexes.size()));
+    for (int vex : vexes) {
+        int idx = graph.GetIndex(vex);
+        assert(graph.if_has_index(idx) && graph.GetVex(idx) == vex);
+    }
+    for (int from : vexes) {
+        std::vector<int> expected;
+        for (int to : vexes) {
+            auto iter = arcs.find({ from, to });
+            if (iter != arcs.end()) {
+                expected.push_back(graph.GetIndex(to));
+            }
+            if (if_weighted) {
+                int cost = (iter != arcs.end()) ? iter->second : (from == to) ? 0 : DS::Graph<int>::LIM;
+                assert(graph.get_low_cost_of(from, to) == cost);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        assert(graph.FindAllAdjIndex(from) == expected);
+        assert(graph.GetDegree(from) == static_cast<int>(expected.size()));
+        assert(graph.FindAdjIndex(from) == (expected.empty() ? -1 : expected.front()));
+    }
+}
+void dynamic_graph_test(bool if_directed, bool if_weighted, bool if_bitset = false) {
+    std::mt19937                       gen(if_directed * 2 + if_weighted + if_bitset * 4);
+    std::vector<int>                   vexes { 0, 1, 2, 3 };
+    std::map<std::pair<int, int>, int> arcs;
+
+    DS::Graph<int> graph = if_weighted
+        ? DS::Graph<int>(vexes, DS::Graph<int>::WEdgeList { { 0, 1, 5 }, { 1, 1, 3 } }, if_directed)
+        : DS::Graph<int>(vexes, DS::Graph<int>::EdgeList { { 0, 1 }, { 1, 1 } }, if_directed, if_bitset);
+    auto add_arc = [&](int from, int to, int weight) {
+        arcs[{ from, to }] = weight;
+        if (!if_directed) {
+            arcs[{ to, from }] = weight;
+        }
+    };
+    add_arc(0, 1, if_weighted ? 5 : 1);
+    add_arc(1, 1, if_weighted ? 3 : 1);
+    check_graph(graph, vexes, arcs, if_weighted);
+
+    int next_vex = 4;
+    for (int step = 0; step < 3000; ++step) {
+        int op = static_cast<int>(gen() % 8);
+        if (op == 0 || vexes.size() < 2) {
+            graph.InsertVex(next_vex);
+            vexes.push_back(next_vex++);
+        } else if (op == 1) {
+            int del = vexes[gen() % vexes.size()];
+            graph.DeleteVex(del);
+            vexes.erase(std::find(vexes.begin(), vexes.end(), del));
+            std::erase_if(arcs, [&](const auto& arc) { return arc.first.first == del || arc.first.second == del; });
+        } else {
+            int from = vexes[gen() % vexes.size()];
+            int to   = vexes[gen() % vexes.size()];
+            if (op <= 3) {
+                graph.DeleteArc(from, to);
+                arcs.erase({ from, to });
+                if (!if_directed) {
+                    arcs.erase({ to, from });
+                }
+            } else {
+                int weight = if_weighted ? static_cast<int>(gen() % 9 + 1) : 1;
+                graph.InsertArc(from, to, weight);
+                add_arc(from, to, weight);
+            }
+        }
+        if (step % 100 == 0) {
+            check_graph(graph, vexes, arcs, if_weighted);
+        }
+    }
+    check_graph(graph, vexes, arcs, if_weighted);
+    assert(graph.IfBitset() == if_bitset);
+
+    // hop distances against a BFS over the reference
+    for (int source : vexes) {
+        std::vector<int> expected(vexes.size(), -1);
+        std::vector<int> index_queue { source };
+        expected[graph.GetIndex(source)] = 0;
+        for (std::size_t head = 0; head < index_queue.size(); ++head) {
+            int from = index_queue[head];
+            for (int to : vexes) {
+                if (arcs.contains({ from, to }) && expected[graph.GetIndex(to)] == -1) {
+                    expected[graph.GetIndex(to)] = expected[graph.GetIndex(from)] + 1;
+                    index_queue.push_back(to);
+                }
+            }
+        }
+        assert(graph.GetHopDist(source) == expected);
+    }
+    if (!if_directed) {
+        long long triangles = 0;
+        for (int a : vexes) {
+            for (int b : vexes) {
+                for (int c : vexes) {
+                    triangles += a < b && b < c && arcs.contains({ a, b }) && arcs.contains({ b, c }) && arcs.contains({ a, c });
+                }
+            }
+        }
+        assert(graph.CountTriangles() == triangles);
+    }
+
+    // copies are independent, deleted names are gone
+    DS::Graph<int> copied = graph;
+    copied.DeleteVex(vexes.front());
+    assert(!copied.if_has_vex(vexes.front()) && graph.if_has_vex(vexes.front()));
+    assert(copied.GetVexNum() + 1 == graph.GetVexNum());
+}
+void GraphTest() {
+    Tool::title_info("Graph");
+
+    for (bool if_directed : { false, true }) {
+        for (bool if_weighted : { false, true }) {
+            dynamic_graph_test(if_directed, if_weighted);
+        }
+        dynamic_graph_test(if_directed, false, true);
+    }
+    bool if_thrown = false;
+    try {
+        DS::Graph<int>(std::vector<int> { 0 }, DS::Graph<int>::WEdgeList {}, false, true);
+    } catch (const std::logic_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // delete down to empty and grow again
+    using StrGraph = DS::Graph<std::string>;
+    StrGraph graph(StrGraph::VertexList { "a", "b" }, StrGraph::EdgeList { { "a", "b" } });
+    graph.DeleteVex("a");
+    graph.DeleteVex("b");
+    assert(graph.GetVexNum() == 0 && !graph.if_has_vex("a"));
+    graph.InsertVex("c");
+    graph.InsertVex("d");
+    graph.InsertArc("c", "d");
+    assert(graph.GetIndex("d") == 1 && graph.FindAllAdjIndex("d") == std::vector<int> { 0 });
+
+    Tool::end_info("Graph");
+}
+
+} // namespace Test
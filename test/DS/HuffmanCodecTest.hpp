@@ -0,0 +1,202 @@
+/**
+ * @file HuffmanCodecTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief HuffmanCodecTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/HuffmanCodec.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Test {
+
+void HuffmanCodecTest() {
+    Tool::title_info("Huffman_Codec");
+
+    auto round_trip = [](const std::vector<std::uint8_t>& data) {
+        auto compressed = DS::HuffmanCodec::compress(data);
+        assert(DS::HuffmanCodec::decompress(compressed) == data);
+        return compressed.size();
+    };
+
+    // corner cases
+    round_trip({});
+    round_trip({ 'a' });
+    round_trip(std::vector<std::uint8_t>(1000, 'z'));
+    round_trip({ 0, 255, 0, 255, 7 });
+
+    // skewed text-like data => compresses
+    std::mt19937              gen(33773);
+    std::vector<std::uint8_t> text;
+    for (int i = 0; i < 200'000; ++i) {
+        // geometric-ish => short and long codes
+        int symbol = 0;
+        while (symbol < 255 && gen() % 3 == 0) {
+            ++symbol;
+        }
+        text.push_back(static_cast<std::uint8_t>('a' + symbol % 26 + (symbol / 26) * 26));
+    }
+    std::size_t text_size = round_trip(text);
+    assert(text_size < text.size() / 2);
+
+    // very deep tree => codes longer than the primary table
+    std::vector<std::uint8_t> deep;
+    std::uint64_t             a = 1, b = 1;
+    for (int symbol = 0; symbol < 25; ++symbol) {
+        deep.insert(deep.end(), a, static_cast<std::uint8_t>(symbol));
+        std::tie(a, b) = std::make_pair(b, a + b);
+    }
+    std::shuffle(deep.begin(), deep.end(), gen);
+    round_trip(deep);
+
+    // uniform random bytes
+    std::vector<std::uint8_t> noise(100'000);
+    for (auto& byte : noise) {
+        byte = static_cast<std::uint8_t>(gen());
+    }
+    round_trip(noise);
+
+    // truncated stream is reported
+    auto compressed = DS::HuffmanCodec::compress(text);
+    compressed.resize(compressed.size() / 2);
+    bool if_thrown = false;
+    try {
+        DS::HuffmanCodec::decompress(compressed);
+    } catch (const std::runtime_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // a header claiming 2^40 bytes is rejected before anything is allocated
+    compressed = DS::HuffmanCodec::compress(std::vector<std::uint8_t> { 'a', 'b', 'c' });
+    compressed[4 + 5] = 1;
+    if_thrown         = false;
+    try {
+        DS::HuffmanCodec::decompress(compressed);
+    } catch (const std::runtime_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // code lengths 1..59, 60, 60 => a complete code, but longer than any
+    // code the encoder writes (and than one refill of the bit reader)
+    compressed = DS::HuffmanCodec::compress(std::vector<std::uint8_t> { 'a', 'b', 'c' });
+    for (int symbol = 0; symbol < 256; ++symbol) {
+        compressed[12 + symbol] = static_cast<std::uint8_t>((symbol < 59) ? symbol + 1 : (symbol < 61) ? 60 : 0);
+    }
+    compressed.resize(DS::HuffmanCodec::HeaderSize);
+    compressed.resize(DS::HuffmanCodec::HeaderSize + 64, 0xFF);
+    if_thrown = false;
+    try {
+        DS::HuffmanCodec::decompress(compressed);
+    } catch (const std::runtime_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+    if_thrown = false;
+    try {
+        DS::HuffmanDecoder decoder(DS::CanonicalHuffmanCode::FromLengths(
+            DS::CanonicalHuffmanCode::LengthTable(compressed.begin() + 12, compressed.begin() + DS::HuffmanCodec::HeaderSize)
+        ));
+    } catch (const std::invalid_argument&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // the decoder owns its code => built from a temporary header
+    {
+        auto                      small = DS::HuffmanCodec::compress(text);
+        DS::HuffmanDecoder        decoder(DS::HuffmanCodec::read_header(small).second);
+        std::vector<std::uint8_t> restored;
+        decoder.decode(std::span<const std::uint8_t>(small).subspan(DS::HuffmanCodec::HeaderSize), text.size(), restored);
+        assert(restored == text);
+    }
+
+    // block parallel container, many tiny blocks on several threads
+    for (auto* data : { &text, &deep, &noise }) {
+        auto blocked = DS::BlockHuffmanCodec::compress(*data, 4096, 4);
+        assert(DS::BlockHuffmanCodec::decompress(blocked, 3) == *data);
+    }
+    assert(DS::BlockHuffmanCodec::decompress(DS::BlockHuffmanCodec::compress({})).empty());
+    assert(DS::BlockHuffmanCodec::count(text, 5) == DS::HuffmanCodec::count(text));
+
+    // one block of 4 GB, and a count that wraps the block count => rejected
+    // before the output is allocated
+    for (std::uint64_t num_of_byte : { std::uint64_t { UINT32_MAX }, std::uint64_t { UINT64_MAX } }) {
+        auto blocked = DS::BlockHuffmanCodec::compress(std::vector<std::uint8_t> { 'a', 'b', 'c' }, 4096);
+        for (int i = 0; i < 8; ++i) {
+            blocked[4 + i] = static_cast<std::uint8_t>(num_of_byte >> (8 * i));
+        }
+        for (int i = 0; i < 4; ++i) {
+            blocked[12 + i] = 0xFF; // block size => 2^32 - 1
+        }
+        if_thrown = false;
+        try {
+            DS::BlockHuffmanCodec::decompress(blocked);
+        } catch (const std::runtime_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+
+    // the same over-long lengths in a block stream header
+    {
+        auto blocked = DS::BlockHuffmanCodec::compress(std::vector<std::uint8_t> { 'a', 'b', 'c' }, 4096);
+        for (int symbol = 0; symbol < 256; ++symbol) {
+            blocked[16 + symbol] = static_cast<std::uint8_t>((symbol < 59) ? symbol + 1 : (symbol < 61) ? 60 : 0);
+        }
+        std::fill(blocked.begin() + DS::BlockHuffmanCodec::HeaderSize + 8, blocked.end(), 0xFF);
+        if_thrown = false;
+        try {
+            DS::BlockHuffmanCodec::decompress(blocked);
+        } catch (const std::runtime_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+
+    // file to file
+    {
+        const std::string raw_path  = "huffman_codec_test.raw";
+        const std::string huf_path  = "huffman_codec_test.huf";
+        const std::string back_path = "huffman_codec_test.out";
+        std::ofstream(raw_path, std::ios::binary)
+            .write(reinterpret_cast<const char*>(text.data()), static_cast<std::streamsize>(text.size()));
+        DS::HuffmanCodec::compress_file(raw_path, huf_path);
+        DS::HuffmanCodec::decompress_file(huf_path, back_path);
+        std::ifstream             back(back_path, std::ios::binary);
+        std::vector<std::uint8_t> restored(
+            (std::istreambuf_iterator<char>(back)), std::istreambuf_iterator<char>()
+        );
+        assert(restored == text);
+        std::remove(raw_path.c_str());
+        std::remove(huf_path.c_str());
+        std::remove(back_path.c_str());
+    }
+
+    std::cout << "text : " << text.size() << " bytes => " << text_size << " bytes" << std::endl;
+    std::cout << std::endl;
+
+    Tool::end_info("Huffman_Codec");
+}
+
+} // namespace Test
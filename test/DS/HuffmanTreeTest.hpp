@@ -13,6 +13,10 @@
 
 #include "../../src/DS/HuffmanTree.hpp"
 #include "../../tools/TestTool.hpp"
+#include <cassert>
+#include <algorithm>
+#include <random>
+#include <tuple>
 #include <string>
 #include <utility>
 
@@ -36,6 +40,103 @@ void HuffmanTreeTest() {
     TestHuffmanTree.EchoInTable();
     TestHuffmanTree.EchoBitCode();
 
+    // every build strategy gives the very same tree
+    {
+        using Strategy = DS::HuffmanTree<int>::BuildStrategy;
+        std::mt19937 gen(33773);
+        for (int num_of_symbol : { 1, 2, 3, 17, 300 }) {
+            DS::HuffmanTree<int>::InitPairList init;
+            for (int symbol = 0; symbol < num_of_symbol; ++symbol) {
+                // few distinct weights => lots of ties
+                init.emplace_back(symbol, static_cast<int>(gen() % 8) + 1);
+            }
+            auto init_heap      = init;
+            auto init_two_queue = init;
+
+            DS::HuffmanTree<int> linear_scan(init, Strategy::LinearScan);
+            DS::HuffmanTree<int> heap(init_heap, Strategy::Heap);
+            DS::HuffmanTree<int> two_queue(init_two_queue, Strategy::TwoQueue);
+            assert(linear_scan.get_bitcode_map() == heap.get_bitcode_map());
+            assert(linear_scan.get_bitcode_map() == two_queue.get_bitcode_map());
+            assert(static_cast<int>(two_queue.get_bitcode_map().size()) == num_of_symbol);
+        }
+    }
+    // adjacent duplicates are dropped before counting the leaves
+    {
+        InitListType dup_list {
+            std::make_pair('a', 1),
+            std::make_pair('a', 1),
+            std::make_pair('b', 2),
+        };
+        DS::HuffmanTree<char> dup_tree(dup_list);
+        auto                  map = dup_tree.get_bitcode_map();
+        assert(map.size() == 2 && map.at('a').size() == 1 && map.at('b').size() == 1);
+    }
+    // canonical code => same lengths as the tree, rebuilt from lengths only
+    {
+        DS::HuffmanTree<int>::InitPairList init;
+        std::mt19937                       gen(7);
+        for (int symbol = 0; symbol < 200; ++symbol) {
+            init.emplace_back(symbol, static_cast<int>(gen() % 1000) + 1);
+        }
+        DS::HuffmanTree<int> tree(init);
+        auto                 canonical = tree.get_canonical_code();
+        for (auto&& [symbol, bit_code] : tree.get_bitcode_map()) {
+            assert(canonical[symbol].length == bit_code.size());
+        }
+        auto rebuilt = DS::CanonicalHuffmanCode::FromLengths(canonical.get_lengths());
+        assert(rebuilt.get_codes() == canonical.get_codes());
+
+        // prefix free => sorted as left aligned 64-bit words, no code
+        // is a prefix of its successor
+        std::vector<DS::PackedBitCode> codes = canonical.get_codes();
+        auto                           left_aligned = [](const DS::PackedBitCode& code) {
+            return code.bits << (64 - code.length);
+        };
+        std::sort(codes.begin(), codes.end(), [&](auto& a, auto& b) {
+            return left_aligned(a) < left_aligned(b);
+        });
+        for (std::size_t i = 0; i + 1 < codes.size(); ++i) {
+            auto& curr = codes[i];
+            auto& next = codes[i + 1];
+            bool  if_prefix = curr.length <= next.length
+                && (next.bits >> (next.length - curr.length)) == curr.bits;
+            assert(!if_prefix);
+        }
+    }
+    // length limited (fibonacci weights => a very deep tree)
+    {
+        DS::HuffmanTree<int>::InitPairList init;
+        int                                a = 1, b = 1;
+        for (int symbol = 0; symbol < 30; ++symbol) {
+            init.emplace_back(symbol, a);
+            std::tie(a, b) = std::make_pair(b, a + b);
+        }
+        DS::HuffmanTree<int> tree(init);
+        auto                 unlimited = tree.get_canonical_code();
+        auto                 limited   = tree.get_canonical_code(12);
+        assert(unlimited.get_max_length() == 29 && limited.get_max_length() == 12);
+
+        auto cost = [&](const DS::CanonicalHuffmanCode& code) {
+            long long res = 0;
+            for (auto&& [symbol, weight] : init) {
+                res += static_cast<long long>(weight) * code[symbol].length;
+            }
+            return res;
+        };
+        assert(cost(limited) >= cost(unlimited));
+        // package-merge without a real limit gives the huffman cost back
+        std::vector<std::uint64_t> weights;
+        for (auto&& [symbol, weight] : init) {
+            weights.push_back(weight);
+        }
+        auto same = DS::CanonicalHuffmanCode::FromLengths(
+            DS::CanonicalHuffmanCode::LimitedLengths(weights, 64)
+        );
+        assert(cost(same) == cost(unlimited));
+        limited.EchoBitCode();
+    }
+
     Tool::end_info("Huffman_Tree");
 }
 
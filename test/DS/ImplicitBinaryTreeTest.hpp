@@ -0,0 +1,105 @@
+/**
+ * @file ImplicitBinaryTreeTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief ImplicitBinaryTreeTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/BinaryTree.hpp"
+#include "../../src/DS/ImplicitBinaryTree.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Test {
+
+void ImplicitBinaryTreeTest() {
+    Tool::title_info("Implicit_Binary_Tree");
+
+    using Implicit = DS::ImplicitBinaryTree<int>;
+
+    // 1. from a complete BinaryTree, same traversal results
+    {
+        auto tree = DS::BinaryTree<int>::CreateBiTree(
+            std::vector<std::string> { "1", "2", "3", "4", "5", "6" }
+        );
+        Implicit implicit = Implicit::FromBinaryTree(tree);
+        assert(implicit.BiTreeSize() == 6 && implicit.BiTreeDepth() == 3);
+
+        std::vector<int> expected;
+        std::vector<int> got;
+        tree.InOrderOpt([&](auto* node) { expected.push_back(tree.Value(node)); });
+        implicit.InOrderOpt([&](Implicit::Index idx) { got.push_back(implicit.Value(idx)); });
+        assert(got == expected);
+
+        expected.clear();
+        got.clear();
+        tree.PreOrderOpt([&](auto* node) { expected.push_back(tree.Value(node)); });
+        implicit.PreOrderOpt([&](Implicit::Index idx) { got.push_back(implicit.Value(idx)); });
+        assert(got == expected);
+
+        assert(implicit.Parent(implicit.LeftChild(2)) == 2);
+        assert(implicit.RightChild(2) == Implicit::npos);
+
+        implicit.LevelOrderTraverse();
+        std::cout << std::endl;
+        implicit.InOrderTraverse();
+        std::cout << std::endl;
+    }
+    // 2. not complete => refused
+    {
+        auto tree = DS::BinaryTree<int>::CreateBiTree(
+            std::vector<std::string> { "1", "2", "3", "#", "5" }
+        );
+        bool if_thrown = false;
+        try {
+            Implicit::FromBinaryTree(tree);
+        } catch (const std::logic_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+    // 3. eytzinger search, compared with std::lower_bound
+    {
+        std::mt19937     gen(33773);
+        std::vector<int> sorted;
+        for (int i = 0; i < 1000; ++i) {
+            sorted.push_back(static_cast<int>(gen() % 3000));
+        }
+        std::sort(sorted.begin(), sorted.end());
+        Implicit eytzinger = Implicit::FromSorted(sorted);
+
+        std::vector<int> in_order;
+        eytzinger.InOrderOpt([&](Implicit::Index idx) { in_order.push_back(eytzinger.Value(idx)); });
+        assert(in_order == sorted);
+
+        for (int value = -5; value < 3005; ++value) {
+            auto            expected = std::lower_bound(sorted.begin(), sorted.end(), value);
+            Implicit::Index got      = eytzinger.LowerBound(value);
+            if (expected == sorted.end()) {
+                assert(got == Implicit::npos);
+            } else {
+                assert(got != Implicit::npos && eytzinger.Value(got) == *expected);
+            }
+            assert(eytzinger.Contains(value) == std::binary_search(sorted.begin(), sorted.end(), value));
+        }
+        assert(Implicit::FromSorted(std::vector<int> {}).LowerBound(1) == Implicit::npos);
+    }
+
+    std::cout << std::endl;
+
+    Tool::end_info("Implicit_Binary_Tree");
+}
+
+} // namespace Test
@@ -12,7 +12,19 @@
 #pragma once
 #include "../../src/DS/SparseMatrix.hpp"
 #include "../../tools/TestTool.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Test {
@@ -57,11 +69,446 @@ void non_empty_test() {
         assert(origin == tr2);
     }
 }
+/// @brief random `num_of_row x num_of_col` CSR, ~`density` of it filled,
+/// a few rows are much heavier than the rest
+DS::CSRMatrix<double> random_csr(std::size_t num_of_row, std::size_t num_of_col, double density, unsigned seed) {
+    std::mt19937                           gen(seed);
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+    std::vector<std::size_t>               row_ptr = { 0 };
+    std::vector<int>                       col_index;
+    std::vector<double>                    values;
+    for (std::size_t row = 0; row < num_of_row; ++row) {
+        double row_density = (row % 17 == 0) ? std::min(1.0, density * 8) : density;
+        for (std::size_t col = 0; col < num_of_col; ++col) {
+            if (value(gen) * 0.5 + 0.5 < row_density) {
+                col_index.push_back(static_cast<int>(col));
+                values.push_back(value(gen));
+            }
+        }
+        row_ptr.push_back(col_index.size());
+    }
+    return { num_of_row, num_of_col, std::move(row_ptr), std::move(col_index), std::move(values) };
+}
+void compressed_test() {
+    std::vector<std::vector<int>> init = {
+        { 0, 1, 0, 0 },
+        { 1, 3, 0, 0 },
+        { 0, 0, 0, 4 },
+    };
+    DS::SparseMatrix<int> origin(init);
+    DS::CSRMatrix<int>    csr = origin.to_csr();
+    DS::CSCMatrix<int>    csc = origin.to_csc();
+    assert(csr.get_nnz() == 4 && csc.get_nnz() == 4);
+    assert(csc.convert() == csr && csr.convert() == csc);
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 4; ++col) {
+            assert(csr.at(row, col) == init[row][col]);
+            assert(csc.at(row, col) == init[row][col]);
+        }
+    }
+    // unsorted triples (a transposed one), cols are sorted inside each row
+    DS::SparseMatrix<int> transposed = origin.col_traverse_transpose();
+    DS::CSRMatrix<int>    csr_of_transposed = transposed.to_csr();
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 4; ++col) {
+            assert(csr_of_transposed.at(col, row) == init[row][col]);
+        }
+    }
+    assert(transposed.to_csc().convert() == csr_of_transposed);
+
+    // SpMV, exact with int
+    std::vector<int> x = { 1, 2, 3, 4 };
+    std::vector<int> y(3);
+    for (unsigned num_of_thread : { 1u, 2u, 3u, 8u }) {
+        csr.multiply(x, y, num_of_thread);
+        assert((y == std::vector<int> { 2, 7, 16 }));
+        csc.multiply(x, y, num_of_thread);
+        assert((y == std::vector<int> { 2, 7, 16 }));
+    }
+    std::vector<int> xt = { 1, 1, 1 };
+    std::vector<int> yt(4);
+    csr.multiply_transposed(xt, yt, 2);
+    assert((yt == std::vector<int> { 1, 4, 0, 4 }));
+    csc.multiply_transposed(xt, yt, 2);
+    assert((yt == std::vector<int> { 1, 4, 0, 4 }));
+
+    bool if_thrown = false;
+    try {
+        csr.multiply(xt, y);
+    } catch (const std::invalid_argument&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+
+    // empty rows and cols
+    DS::SparseMatrix<int> empty(std::vector<std::vector<int>> { {} });
+    assert(empty.to_csr().get_nnz() == 0 && empty.to_csc().get_num_of_row() == 1);
+}
+void spmv_test() {
+    const std::size_t num_of_row = 301;
+    const std::size_t num_of_col = 257;
+
+    DS::CSRMatrix<double> csr = random_csr(num_of_row, num_of_col, 0.05, 33773);
+    DS::CSCMatrix<double> csc = csr.convert();
+
+    std::vector<double> x(num_of_col);
+    for (std::size_t col = 0; col < num_of_col; ++col) {
+        x[col] = 1.0 / (1.0 + col);
+    }
+    std::vector<double> expected(num_of_row, 0.0);
+    for (std::size_t row = 0; row < num_of_row; ++row) {
+        for (std::size_t col = 0; col < num_of_col; ++col) {
+            expected[row] += csr.at(row, col) * x[col];
+        }
+    }
+    auto if_close = [](const std::vector<double>& lhs, const std::vector<double>& rhs) {
+        for (std::size_t idx = 0; idx < lhs.size(); ++idx) {
+            if (std::abs(lhs[idx] - rhs[idx]) > 1e-9) {
+                return false;
+            }
+        }
+        return lhs.size() == rhs.size();
+    };
+    std::vector<double> y(num_of_row);
+    for (unsigned num_of_thread : { 1u, 4u }) {
+        csr.multiply(x, y, num_of_thread);
+        assert(if_close(y, expected));
+        csc.multiply(x, y, num_of_thread);
+        assert(if_close(y, expected));
+    }
+    assert(if_close(csr * x, expected));
+}
+/// @brief dense reference, `at` on every entry
+std::vector<std::vector<double>> dense_of_csr(const DS::CSRMatrix<double>& csr) {
+    std::vector<std::vector<double>> res(csr.get_num_of_row(), std::vector<double>(csr.get_num_of_col()));
+    for (std::size_t row = 0; row < csr.get_num_of_row(); ++row) {
+        for (std::size_t col = 0; col < csr.get_num_of_col(); ++col) {
+            res[row][col] = csr.at(row, col);
+        }
+    }
+    return res;
+}
+void spgemm_test() {
+    auto if_same = [](const DS::CSRMatrix<double>& res, const std::vector<std::vector<double>>& expected) {
+        auto dense = dense_of_csr(res);
+        for (std::size_t row = 0; row < dense.size(); ++row) {
+            for (std::size_t col = 0; col < dense[row].size(); ++col) {
+                if (std::abs(dense[row][col] - expected[row][col]) > 1e-9) {
+                    return false;
+                }
+            }
+        }
+        return dense.size() == expected.size();
+    };
+    // narrow rhs => dense accumulator, wide and very sparse rhs => hash
+    for (auto [num_of_col, density] : { std::pair { 40, 0.2 }, std::pair { 5000, 0.002 } }) {
+        DS::CSRMatrix<double> lhs = random_csr(63, 90, 0.1, 1);
+        DS::CSRMatrix<double> rhs = random_csr(90, num_of_col, density, 2);
+
+        auto lhs_dense = dense_of_csr(lhs);
+        auto rhs_dense = dense_of_csr(rhs);
+
+        std::vector<std::vector<double>> expected(63, std::vector<double>(num_of_col, 0.0));
+        for (std::size_t row = 0; row < 63; ++row) {
+            for (std::size_t mid = 0; mid < 90; ++mid) {
+                for (int col = 0; col < num_of_col; ++col) {
+                    expected[row][col] += lhs_dense[row][mid] * rhs_dense[mid][col];
+                }
+            }
+        }
+        for (unsigned num_of_thread : { 1u, 4u }) {
+            DS::CSRMatrix<double> res = DS::SparseArithmetic::multiply(lhs, rhs, num_of_thread);
+            assert(if_same(res, expected));
+            // no duplicated or unsorted cols in any row
+            for (std::size_t row = 0; row < res.get_num_of_row(); ++row) {
+                auto beg = res.get_indexes().begin() + res.get_ptr()[row];
+                auto end = res.get_indexes().begin() + res.get_ptr()[row + 1];
+                assert(std::adjacent_find(beg, end, std::greater_equal<int>()) == end);
+            }
+        }
+    }
+    // add / subtract
+    {
+        DS::CSRMatrix<double> lhs = random_csr(50, 70, 0.1, 3);
+        DS::CSRMatrix<double> rhs = random_csr(50, 70, 0.1, 4);
+
+        auto lhs_dense = dense_of_csr(lhs);
+        auto rhs_dense = dense_of_csr(rhs);
+        auto sum       = lhs_dense;
+        auto diff      = lhs_dense;
+        for (std::size_t row = 0; row < 50; ++row) {
+            for (std::size_t col = 0; col < 70; ++col) {
+                sum[row][col]  += rhs_dense[row][col];
+                diff[row][col] -= rhs_dense[row][col];
+            }
+        }
+        for (unsigned num_of_thread : { 1u, 3u }) {
+            assert(if_same(DS::SparseArithmetic::add(lhs, rhs, num_of_thread), sum));
+            assert(if_same(DS::SparseArithmetic::subtract(lhs, rhs, num_of_thread), diff));
+        }
+        // the structure is kept even where the values cancel
+        assert(DS::SparseArithmetic::subtract(lhs, lhs).get_nnz() == lhs.get_nnz());
+    }
+    // on SparseMatrix itself
+    {
+        DS::SparseMatrix<int> lhs(std::vector<std::vector<int>> {
+            { 1, 0, 2 },
+            { 0, 3, 0 },
+        });
+        DS::SparseMatrix<int> rhs(std::vector<std::vector<int>> {
+            { 0, 1 },
+            { 4, 0 },
+            { 0, 5 },
+        });
+        DS::SparseMatrix<int> product(std::vector<std::vector<int>> {
+            { 0, 11 },
+            { 12, 0 },
+        });
+        DS::SparseMatrix<int> doubled(std::vector<std::vector<int>> {
+            { 2, 0, 4 },
+            { 0, 6, 0 },
+        });
+        assert(lhs * rhs == product);
+        assert(lhs + lhs == doubled);
+        assert(doubled - lhs == lhs);
+
+        bool if_thrown = false;
+        try {
+            auto wrong = lhs + rhs;
+        } catch (const std::invalid_argument&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+}
+void parallel_transpose_test() {
+    // the radix variant needs more cols than one low-bits bucket
+    for (auto [num_of_row, num_of_col] : { std::pair { 97, 61 }, std::pair { 40, 9000 } }) {
+        DS::CSRMatrix<double> csr      = random_csr(num_of_row, num_of_col, 0.02, 5);
+        DS::CSCMatrix<double> expected = csr.convert();
+        for (unsigned num_of_thread : { 1u, 2u, 5u }) {
+            assert(csr.convert(num_of_thread) == expected);
+            assert(csr.convert_radix(num_of_thread) == expected);
+            assert(expected.convert_radix(num_of_thread) == csr);
+        }
+
+        DS::SparseMatrix<double> origin = DS::SparseMatrix<double>::FromCSR(csr);
+        DS::SparseMatrix<double> tr     = origin.fast_transpose();
+        for (unsigned num_of_thread : { 1u, 3u, 8u }) {
+            assert(origin.parallel_transpose(num_of_thread) == tr);
+        }
+        assert(tr.parallel_transpose() == origin);
+    }
+    DS::CSRMatrix<double> empty;
+    assert(empty.convert_radix(4) == empty.convert(4));
+}
+void triplet_and_market_test() {
+    using Builder = DS::TripletBuilder<double>;
+
+    // any order, duplicates summed or overwritten
+    {
+        Builder builder(3, 4);
+        builder.add(2, 3, 4.0);
+        builder.add(0, 1, 1.0);
+        builder.add(1, 1, 3.0);
+        builder.add(1, 0, 1.0);
+        builder.add(1, 1, 2.0);
+        for (unsigned num_of_thread : { 1u, 2u }) {
+            DS::CSRMatrix<double> sum  = builder.build(Builder::Duplicate::Sum, num_of_thread);
+            DS::CSRMatrix<double> last = builder.build(Builder::Duplicate::KeepLast, num_of_thread);
+            assert(sum.get_nnz() == 4 && last.get_nnz() == 4);
+            assert(sum.at(1, 1) == 5.0 && last.at(1, 1) == 2.0);
+            assert(sum.at(1, 0) == 1.0 && sum.at(2, 3) == 4.0 && sum.at(0, 1) == 1.0);
+        }
+        bool if_thrown = false;
+        try {
+            builder.add(3, 0, 1.0);
+        } catch (const std::out_of_range&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+    }
+    // flat dense input
+    {
+        std::vector<int>      dense  = { 0, 1, 0, 0, 1, 3, 0, 0, 0, 0, 0, 4 };
+        DS::SparseMatrix<int> origin = DS::SparseMatrix<int>::FromDense(dense, 3, 4);
+        assert(origin == DS::SparseMatrix<int>(std::vector<std::vector<int>> {
+                   { 0, 1, 0, 0 },
+                   { 1, 3, 0, 0 },
+                   { 0, 0, 0, 4 },
+               }));
+    }
+    // save => load round trip, then a hand written symmetric pattern file
+    {
+        const std::string     path     = "sparse_matrix_test.mtx";
+        DS::CSRMatrix<double> expected = random_csr(300, 200, 0.05, 6);
+        DS::MatrixMarket::save(path, expected);
+        for (unsigned num_of_thread : { 1u, 4u }) {
+            assert(DS::MatrixMarket::load<double>(path, num_of_thread) == expected);
+        }
+        assert(DS::MatrixMarket::read_header(path).num_of_entry == expected.get_nnz());
+        assert(DS::SparseMatrix<double>::FromMatrixMarket(path).to_csr() == expected);
+
+        std::ofstream(path) << "%%MatrixMarket matrix coordinate pattern symmetric\n"
+                            << "% comment\n"
+                            << "3 3 3\n"
+                            << "1 1\n"
+                            << "3 1\n"
+                            << "  2 3  \r\n";
+        DS::CSRMatrix<int> pattern = DS::MatrixMarket::load<int>(path);
+        assert(pattern.get_nnz() == 5 && pattern.at(0, 2) == 1 && pattern.at(2, 0) == 1 && pattern.at(1, 1) == 0);
+
+        std::ofstream(path) << "%%MatrixMarket matrix coordinate real general\n"
+                            << "2 2 2\n"
+                            << "1 1 1.5\n";
+        bool if_thrown = false;
+        try {
+            DS::MatrixMarket::load<double>(path);
+        } catch (const std::runtime_error&) {
+            if_thrown = true; // truncated
+        }
+        assert(if_thrown);
+
+        // 3e9 rows do not fit an `int` index
+        std::ofstream(path) << "%%MatrixMarket matrix coordinate real general\n"
+                            << "3000000000 2 1\n"
+                            << "2999999999 1 1.5\n";
+        if_thrown = false;
+        try {
+            DS::MatrixMarket::load<double>(path);
+        } catch (const std::length_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+        if_thrown = false;
+        try {
+            DS::TripletBuilder<double, std::int16_t>(3, 32768);
+        } catch (const std::length_error&) {
+            if_thrown = true;
+        }
+        assert(if_thrown);
+        DS::TripletBuilder<double, std::int16_t>(32767, 32767).add(32766, 32766, 1.0);
+        std::remove(path.c_str());
+    }
+}
+void coordinate_test() {
+    static_assert(std::is_trivially_copyable_v<DS::ElementInfo<double>>);
+    static_assert(DS::CoordinateMatrix<double, std::uint16_t>::BytesOfNonZero == 12);
+
+    DS::CSRMatrix<double>    csr    = random_csr(120, 90, 0.05, 7);
+    DS::SparseMatrix<double> origin = DS::SparseMatrix<double>::FromCSR(csr);
+
+    auto wide   = origin.to_coordinate();
+    auto narrow = origin.to_coordinate<std::uint16_t>();
+    assert(wide.if_valid() && narrow.if_valid() && wide.if_row_major());
+    assert(DS::SparseMatrix<double>::FromCoordinate(narrow) == origin);
+    assert(wide.to_csr<int>() == csr && narrow.to_csr<int>() == csr);
+    assert((DS::CoordinateMatrix<double, std::int32_t>::FromCSR(csr) == wide));
+
+    // same order as the AoS transpose, back to row major when sorted again
+    auto tr = narrow.transpose();
+    assert(DS::SparseMatrix<double>::FromCoordinate(tr) == origin.fast_transpose());
+    assert(tr.transpose() == narrow);
+    assert(tr.if_row_major() && tr.sort_row_major() == tr);
+
+    // out of order => sorted first, too narrow an index => thrown
+    DS::CoordinateMatrix<int, std::uint8_t> small(3, 3);
+    small.add(2, 0, 1);
+    small.add(0, 2, 2);
+    small.add(0, 1, 3);
+    bool if_thrown = false;
+    try {
+        small.to_csr();
+    } catch (const std::logic_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+    auto sorted = small.sort_row_major();
+    assert(sorted.if_row_major() && sorted.to_csr().at(0, 1) == 3 && sorted.to_csr().at(2, 0) == 1);
+
+    if_thrown = false;
+    try {
+        DS::CoordinateMatrix<double, std::uint8_t>(256, 257);
+    } catch (const std::length_error&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+}
+/// @brief FEM-like => dense `block x block` couplings between random nodes
+DS::CSRMatrix<double> random_block_csr(std::size_t num_of_node, std::size_t block, std::uint64_t seed) {
+    std::mt19937_64                        gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    DS::TripletBuilder<double>             builder(num_of_node * block, num_of_node * block);
+    for (std::size_t node = 0; node < num_of_node; ++node) {
+        for (std::size_t idx = 0; idx < 4; ++idx) {
+            std::size_t other = (idx == 0) ? node : gen() % num_of_node;
+            for (std::size_t row = 0; row < block; ++row) {
+                for (std::size_t col = 0; col < block; ++col) {
+                    if (gen() % 8) { // some holes inside the blocks
+                        builder.add(node * block + row, other * block + col, dist(gen));
+                    }
+                }
+            }
+        }
+    }
+    return builder.build();
+}
+template <std::size_t BlockRow, std::size_t BlockCol>
+void block_spmv_test(const DS::CSRMatrix<double>& csr) {
+    auto bsr = DS::BlockMatrix<double, BlockRow, BlockCol>::FromCSR(csr);
+    assert(bsr.get_num_of_row() == csr.get_num_of_row() && bsr.get_num_of_col() == csr.get_num_of_col());
+    assert(bsr.to_csr() == csr);
+    assert(bsr.fill_ratio() > 0 && bsr.fill_ratio() <= 1);
+
+    std::vector<double> x(csr.get_num_of_col());
+    for (std::size_t col = 0; col < x.size(); ++col) {
+        x[col] = 1.0 / (1.0 + col);
+    }
+    std::vector<double> expected(csr.get_num_of_row());
+    csr.multiply(x, expected);
+    std::vector<double> y(csr.get_num_of_row());
+    for (unsigned num_of_thread : { 1u, 3u }) {
+        std::fill(y.begin(), y.end(), -1.0);
+        bsr.multiply(x, y, num_of_thread);
+        for (std::size_t row = 0; row < y.size(); ++row) {
+            assert(std::abs(y[row] - expected[row]) < 1e-9);
+        }
+    }
+}
+void block_test() {
+    block_spmv_test<4, 4>(random_block_csr(97, 4, 1));
+    block_spmv_test<8, 8>(random_block_csr(41, 8, 2));
+    block_spmv_test<2, 2>(random_block_csr(50, 2, 3));
+    // blocks that do not match the structure, odd sizes => scalar kernel
+    block_spmv_test<4, 4>(random_csr(96, 128, 0.05, 4));
+    block_spmv_test<3, 5>(random_csr(99, 100, 0.05, 5));
+
+    // int => scalar kernel, empty block rows
+    DS::CSRMatrix<int> small(8, 8, { 0, 1, 1, 1, 1, 1, 1, 1, 2 }, { 5, 7 }, { 3, 4 });
+    auto               bsr = DS::BSRMatrix<int, 4>::FromCSR(small);
+    assert(bsr.get_num_of_block() == 2 && bsr.to_csr() == small);
+    assert((bsr * std::vector<int>(8, 2) == std::vector<int> { 6, 0, 0, 0, 0, 0, 0, 8 }));
+
+    bool if_thrown = false;
+    try {
+        DS::BSRMatrix<double, 4>::FromCSR(random_csr(10, 12, 0.1, 6));
+    } catch (const std::invalid_argument&) {
+        if_thrown = true;
+    }
+    assert(if_thrown);
+}
 void SparseMatrixTest() {
     Tool::title_info("Sparse_Matrix");
 
     non_empty_test();
     empty_test();
+    compressed_test();
+    spmv_test();
+    spgemm_test();
+    parallel_transpose_test();
+    triplet_and_market_test();
+    coordinate_test();
+    block_test();
 
     std::cout << "Original -> FirstTransposed -> SecondTransposed" << std::endl;
     std::cout << std::endl;
@@ -75,6 +522,21 @@ void SparseMatrixTest() {
     std::cout << "Transpose is successful!" << std::endl;
     std::cout << std::endl;
 
+    std::cout << "CSR / CSC conversion and SpMV are successful!" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "SpGEMM and sparse add / subtract are successful!" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Parallel and radix transposes match the serial one!" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Triplet builder and Matrix Market loading are successful!" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Structure-of-arrays storage is successful!" << std::endl;
+    std::cout << std::endl;
+
     Tool::end_info("Sparse_Matrix");
 }
 
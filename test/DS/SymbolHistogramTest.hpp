@@ -0,0 +1,81 @@
+/**
+ * @file SymbolHistogramTest.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief SymbolHistogramTest
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include "../../src/DS/HuffmanTree.hpp"
+#include "../../src/DS/SymbolHistogram.hpp"
+#include "../../tools/TestTool.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Test {
+
+void SymbolHistogramTest() {
+    Tool::title_info("Symbol_Histogram");
+
+    std::mt19937 gen(33773);
+
+    // bytes, odd length => the scalar tail is used as well
+    {
+        std::vector<std::uint8_t> bytes(100'003);
+        for (auto& byte : bytes) {
+            byte = static_cast<std::uint8_t>(gen() % 7 == 0 ? gen() : 'e');
+        }
+        DS::SymbolHistogram::ByteCounts expected {};
+        for (std::uint8_t byte : bytes) {
+            ++expected[byte];
+        }
+        for (unsigned num_of_thread : { 1u, 3u, 8u }) {
+            assert(DS::SymbolHistogram::count_bytes(bytes, num_of_thread) == expected);
+        }
+        assert(DS::SymbolHistogram::count_bytes({}) == DS::SymbolHistogram::ByteCounts {});
+    }
+    // 16-bit symbols
+    {
+        std::vector<std::uint16_t> words(50'001);
+        for (auto& word : words) {
+            word = static_cast<std::uint16_t>(gen() % 3 == 0 ? gen() : 42);
+        }
+        DS::SymbolHistogram::WordCounts expected(65536, 0);
+        for (std::uint16_t word : words) {
+            ++expected[word];
+        }
+        for (unsigned num_of_thread : { 1u, 4u }) {
+            assert(DS::SymbolHistogram::count_words(words, num_of_thread) == expected);
+        }
+    }
+    // straight into HuffmanTree
+    {
+        std::vector<std::uint8_t> bytes { 'a', 'b', 'b', 'c', 'c', 'c', 'c' };
+
+        auto counts = DS::SymbolHistogram::count_bytes(bytes);
+        auto init   = DS::HuffmanTree<std::uint8_t>::init_from_counts(counts);
+        assert(init.size() == 3);
+        DS::HuffmanTree<std::uint8_t> tree(init);
+        auto                          lengths = tree.get_code_lengths();
+        assert(lengths['c'] == 1 && lengths['a'] == 2 && lengths['b'] == 2);
+
+        // huge counts are scaled down, but never to 0
+        std::vector<std::uint64_t> huge { 1, std::uint64_t { 1 } << 40, 0, 5 };
+        auto                       scaled = DS::HuffmanTree<int>::init_from_counts(huge);
+        assert(scaled.size() == 3 && scaled[0].second == 1 && scaled[2].second == 1);
+    }
+
+    std::cout << std::endl;
+
+    Tool::end_info("Symbol_Histogram");
+}
+
+} // namespace Test
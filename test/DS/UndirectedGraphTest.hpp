@@ -13,6 +13,7 @@
 #include "../../src/DS/UndirectedGraph.hpp"
 #include "../../tools/TestTool.hpp"
 
+#include <cassert>
 #include <string>
 #include <utility>
 #include <vector>
@@ -53,6 +54,24 @@ void UndirectedGraphTest() {
 
     test1.DFSTraverse();
     std::cout << std::endl;
+
+    // bit parallel queries => the only triangle is a-b-e
+    assert(test1.GetDegree("a") == 3 && test1.CountCommonAdj("a", "b") == 1);
+    assert(test1.CountTriangles() == 1);
+    assert(test1.GetHopDist("f") == (std::vector<int> { 2, 3, 1, 2, 3, 0 }));
+
+    // delete => the last vertex takes the hole, insert => one new row
+    StrGraph test2(VexList, EdgeList);
+    test2.DeleteVex("b");
+    assert(!test2.if_has_vex("b") && test2.GetIndex("f") == 1 && test2.GetVex(1) == "f");
+    assert(test2.FindAllAdjIndex("f") == std::vector<int> { test2.GetIndex("c") });
+    assert(test2.FindAllAdjIndex("d") == std::vector<int> { test2.GetIndex("c") });
+    test2.InsertVex("g");
+    test2.InsertArc("g", "a");
+    assert(test2.GetIndex("g") == 5 && test2.FindAllAdjIndex("g") == std::vector<int> { 0 });
+    assert(test2.FindAllAdjIndex("a").size() == 3);
+    test2.DeleteVex("g");
+    assert(test2.FindAllAdjIndex("a").size() == 2);
 }
 
 } // namespace Test
\ No newline at end of file
@@ -14,18 +14,29 @@
 #include "Algorithm/DijkstraTest.hpp"
 #include "Algorithm/FloydTest.hpp"
 #include "Algorithm/PrimTest.hpp"
+#include "DS/AdaptiveHuffmanTest.hpp"
+#include "DS/ArenaBinaryTreeTest.hpp"
 #include "DS/BSTTest.hpp"
+#include "DS/BitAdjacencyTest.hpp"
+#include "DS/BTreeTest.hpp"
+#include "DS/BinaryTreeTest.hpp"
+#include "DS/ConcurrentSkipListTest.hpp"
+#include "DS/FlatHashMapTest.hpp"
+#include "DS/GraphSnapshotTest.hpp"
+#include "DS/GraphTest.hpp"
+#include "DS/HuffmanCodecTest.hpp"
+#include "DS/HuffmanTreeTest.hpp"
+#include "DS/ImplicitBinaryTreeTest.hpp"
 // #include "Algorithm/MergeUniqueTest.hpp"
-// #include "DS/BinaryTreeTest.hpp"
 // #include "DS/ChildSiblingTreeTest.hpp"
 // #include "DS/DoubleListTest.hpp"
 // #include "DS/DynamicArrayTest.hpp"
-// #include "DS/HuffmanTreeTest.hpp"
 // #include "DS/ListTest.hpp"
 // #include "DS/QueueTest.hpp"
 // #include "DS/SingleListTest.hpp"
-// #include "DS/SparseMatrixTest.hpp"
 // #include "DS/StackTest.hpp"
+#include "DS/SparseMatrixTest.hpp"
+#include "DS/SymbolHistogramTest.hpp"
 #include "DS/UndirectedGraphTest.hpp"
 
 #include <functional>
@@ -42,15 +53,26 @@ void run_all_test() {
         // MergeUniqueTest,      // success
         // SeqStackTest,         // success
         // ChainedQueueTest,     // success
-        // SparseMatrixTest,     // success
-        // BinaryTreeTest,       // success, but not complete
-        UndirectedGraphTest, // success, but not complete
-        // HuffmanTreeTest,      // success
+        SparseMatrixTest,        // success
+        BinaryTreeTest,          // success, but not complete
+        UndirectedGraphTest,     // success, but not complete
+        GraphTest,               // success
+        HuffmanTreeTest,         // success
         // ChildSiblingTreeTest, // success
-        DijkstraTest, // success
-        FloydTest,    // success
-        PrimTest,     // success
-        BSTTest,      // success
+        DijkstraTest,            // success
+        FloydTest,               // success
+        PrimTest,                // success
+        BSTTest,                 // success
+        BTreeTest,               // success
+        ConcurrentSkipListTest,  // success
+        ArenaBinaryTreeTest,     // success
+        ImplicitBinaryTreeTest,  // success
+        HuffmanCodecTest,        // success
+        SymbolHistogramTest,     // success
+        AdaptiveHuffmanTest,     // success
+        FlatHashMapTest,         // success
+        BitAdjacencyTest,        // success
+        GraphSnapshotTest,       // success
     };
     for (auto&& func : test_list) {
         func();
@@ -0,0 +1,56 @@
+/**
+ * @file BenchTool.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief A tool to time and report a benchmark case
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace Tool {
+
+/// @brief @b wall_clock_of_the_given_callable (in milliseconds)
+template <typename Func>
+double time_it(Func&& func) {
+    auto beg = std::chrono::steady_clock::now();
+    std::forward<Func>(func)();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - beg).count();
+}
+
+void bench_title_info(const char* name) {
+    std::cout << "========== Benchmark of `"
+              << name
+              << "` is started ========== " << std::endl;
+    std::cout << std::endl;
+}
+
+void bench_end_info(const char* name) {
+    std::cout << "========== Benchmark of `"
+              << name
+              << "` is ended ========== " << std::endl;
+    std::cout << std::endl;
+}
+
+void bench_case_info(const char* name, double ms) {
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+              << ms << " ms" << std::endl;
+}
+
+void bench_throughput_info(const char* name, double ms, double num_of_byte) {
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+              << ms << " ms"
+              << std::setw(12) << num_of_byte / (1 << 20) / (ms / 1000) << " MB/s" << std::endl;
+}
+
+} // namespace Tool
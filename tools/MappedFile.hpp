@@ -0,0 +1,130 @@
+/**
+ * @file MappedFile.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Read-only memory mapped file (plain read as a fallback)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TOOL_HAS_MMAP 1
+#else
+#include <fstream>
+#include <vector>
+#endif
+
+namespace Tool {
+
+/// @brief @b MappedFile, the whole file as one read-only byte range.
+/// pages are loaded lazily by the OS and shared with the page cache,
+/// so opening is O(1) whatever the size of the file
+class MappedFile {
+    const std::uint8_t* data = nullptr;
+    std::size_t         size = 0;
+#ifdef TOOL_HAS_MMAP
+    void* mapping = nullptr;
+#else
+    std::vector<std::uint8_t> buffer;
+#endif
+
+    void release() {
+#ifdef TOOL_HAS_MMAP
+        if (mapping) {
+            ::munmap(mapping, size);
+        }
+        mapping = nullptr;
+#else
+        buffer.clear();
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef TOOL_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat " + path);
+        }
+        size = static_cast<std::size_t>(info.st_size);
+        if (size) { // mapping 0 bytes is an error
+            mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                ::close(fd);
+                throw std::runtime_error("Cannot map " + path);
+            }
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+            data = static_cast<const std::uint8_t*>(mapping);
+        }
+        ::close(fd); // the mapping keeps the file alive
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        in.seekg(0, std::ios::end);
+        buffer.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0, std::ios::beg);
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        data = buffer.data();
+        size = buffer.size();
+#endif
+    }
+    ~MappedFile() { release(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& moved) noexcept
+        : data(std::exchange(moved.data, nullptr))
+        , size(std::exchange(moved.size, 0))
+#ifdef TOOL_HAS_MMAP
+        , mapping(std::exchange(moved.mapping, nullptr))
+#else
+        , buffer(std::move(moved.buffer))
+#endif
+    {
+    }
+    MappedFile& operator=(MappedFile&& moved) noexcept {
+        if (&moved == this) {
+            return *this;
+        }
+        release();
+        data = std::exchange(moved.data, nullptr);
+        size = std::exchange(moved.size, 0);
+#ifdef TOOL_HAS_MMAP
+        mapping = std::exchange(moved.mapping, nullptr);
+#else
+        buffer = std::move(moved.buffer);
+#endif
+        return *this;
+    }
+
+    std::span<const std::uint8_t> bytes() const { return { data, size }; }
+    std::string_view              text() const { return { reinterpret_cast<const char*>(data), size }; }
+    std::size_t                   get_size() const { return size; }
+};
+
+} // namespace Tool
@@ -0,0 +1,84 @@
+/**
+ * @file Parallel.hpp
+ * @author Eden (edwardwang33773@gmail.com)
+ * @brief Minimal fork-join helpers on std::thread
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tool {
+
+/// @brief @b default_num_of_worker => one per hardware thread
+unsigned num_of_worker() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// @brief @b run_on_workers => func(worker_id) on `num_of_thread` threads
+/// (the calling thread is worker 0), the first exception is re-thrown
+template <typename Func>
+void run_on_workers(unsigned num_of_thread, Func&& func) {
+    num_of_thread = std::max(1u, num_of_thread);
+    std::exception_ptr first_error;
+    std::mutex         error_mutex;
+    auto               guarded = [&](unsigned worker_id) {
+        try {
+            func(worker_id);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_of_thread - 1);
+    for (unsigned worker_id = 1; worker_id < num_of_thread; ++worker_id) {
+        workers.emplace_back(guarded, worker_id);
+    }
+    guarded(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+/// @brief @b parallel_for_range (static partition)
+/// func(worker_id, beg, end) on contiguous, nearly equal slices of [0, num)
+template <typename Func>
+void parallel_for_range(std::size_t num, Func&& func, unsigned num_of_thread = num_of_worker()) {
+    num_of_thread = static_cast<unsigned>(std::clamp<std::size_t>(num, 1, std::max(1u, num_of_thread)));
+    run_on_workers(num_of_thread, [&](unsigned worker_id) {
+        std::size_t beg = num * worker_id / num_of_thread;
+        std::size_t end = num * (worker_id + 1) / num_of_thread;
+        func(worker_id, beg, end);
+    });
+}
+
+/// @brief @b parallel_for (dynamic partition) => func(idx) for idx in [0, num)
+/// indexes are handed out one by one, good for uneven work items
+template <typename Func>
+void parallel_for(std::size_t num, Func&& func, unsigned num_of_thread = num_of_worker()) {
+    num_of_thread = static_cast<unsigned>(std::clamp<std::size_t>(num, 1, std::max(1u, num_of_thread)));
+    std::atomic<std::size_t> next { 0 };
+    run_on_workers(num_of_thread, [&](unsigned) {
+        for (std::size_t idx = next++; idx < num; idx = next++) {
+            func(idx);
+        }
+    });
+}
+
+} // namespace Tool
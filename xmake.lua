@@ -4,6 +4,9 @@ target("DS_Exp")
     set_kind("binary")
     add_files("src/*.cpp")
     set_languages("c17", "c++20")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
 
 --
 -- If you want to known more usage about xmake, please see https://xmake.io